@@ -0,0 +1,13 @@
+#version 330 core
+
+layout (location = 0) in vec3 vertex ;
+layout (location = 1) in vec3 color ;
+
+out vec3 lineColor;
+
+uniform mat4 viewProjection ;
+
+void main() {
+    gl_Position = viewProjection * vec4(vertex, 1.0);
+    lineColor = color;
+}
@@ -0,0 +1,16 @@
+#version 330 core
+
+// point of the unit sphere
+layout (location = 0) in vec3 vertex ;
+// center (xyz) and radius (w) of the instance
+layout (location = 1) in vec4 sphere ;
+layout (location = 2) in vec3 color ;
+
+out vec3 lineColor;
+
+uniform mat4 viewProjection ;
+
+void main() {
+    gl_Position = viewProjection * vec4(sphere.xyz + vertex * sphere.w, 1.0);
+    lineColor = color;
+}
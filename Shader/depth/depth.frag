@@ -1,27 +1,31 @@
-#version 330 core
-
-out vec4 FragColor;
-
-in vec2 TexCoords;
-flat in int fragSamples;
-
-uniform sampler2DMS screenTexture;
-
-void main() {
-    float zNear = 0.1;
-    float zFar = 100.0;
-
-    ivec2 texSize = textureSize(screenTexture);
-    ivec2 newTexCoord = ivec2(TexCoords.x * texSize.x, TexCoords.y * texSize.y);
-
-    float color = 0.0;
-
-    for (int i = 0; i < fragSamples; i++) {
-        color += texelFetch(screenTexture, newTexCoord, i).x;
-    }
-
-    color /= float(fragSamples);
-
-    float linearColor = (2.0 * zNear) / (zFar + zNear - color * (zFar - zNear));
-    FragColor = vec4(linearColor, linearColor, linearColor, 1.0);
+#version 330 core
+#pragma features SAMPLES
+
+#ifndef SAMPLES
+#define SAMPLES 1
+#endif
+
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+uniform sampler2DMS screenTexture;
+
+void main() {
+    float zNear = 0.1;
+    float zFar = 100.0;
+
+    // the pass can cover only part of the texture (dynamic resolution), so the texel is the fragment position
+    ivec2 newTexCoord = ivec2(gl_FragCoord.xy);
+
+    float color = 0.0;
+
+    for (int i = 0; i < SAMPLES; i++) {
+        color += texelFetch(screenTexture, newTexCoord, i).x;
+    }
+
+    color /= float(SAMPLES);
+
+    float linearColor = (2.0 * zNear) / (zFar + zNear - color * (zFar - zNear));
+    FragColor = vec4(linearColor, linearColor, linearColor, 1.0);
 }
\ No newline at end of file
@@ -0,0 +1,8 @@
+#version 440 compatibility
+
+out vec3 finalColor;
+
+// flat grey for the entities whose shader is still compiling
+void main() {
+  finalColor = vec3(0.5, 0.5, 0.5);
+}
@@ -0,0 +1,70 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+uniform sampler2D screenTexture;
+// size of one pixel in uv coordinates
+uniform vec2 texelSize;
+// last uv inside the rendered area (dynamic resolution)
+uniform vec2 uvMax;
+
+// how far along the edge the blur is allowed to search, in pixels
+const float SPAN_MAX = 8.0;
+// keeps the search direction from blowing up on very dark edges
+const float REDUCE_MUL = 1.0 / 8.0;
+const float REDUCE_MIN = 1.0 / 128.0;
+// contrast below which the pixel is left untouched
+const float EDGE_THRESHOLD = 1.0 / 16.0;
+
+float luma(vec3 color) {
+    return dot(color, vec3(0.299, 0.587, 0.114));
+}
+
+vec3 sampleScreen(vec2 uv) {
+    return texture(screenTexture, min(uv, uvMax)).rgb;
+}
+
+void main() {
+    vec3 center = sampleScreen(TexCoords);
+
+    float lumaCenter = luma(center);
+    float lumaNW = luma(sampleScreen(TexCoords + vec2(-1.0, 1.0) * texelSize));
+    float lumaNE = luma(sampleScreen(TexCoords + vec2(1.0, 1.0) * texelSize));
+    float lumaSW = luma(sampleScreen(TexCoords + vec2(-1.0, -1.0) * texelSize));
+    float lumaSE = luma(sampleScreen(TexCoords + vec2(1.0, -1.0) * texelSize));
+
+    float lumaMin = min(lumaCenter, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));
+    float lumaMax = max(lumaCenter, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));
+
+    // flat areas don't need any filtering
+    if (lumaMax - lumaMin < max(EDGE_THRESHOLD * lumaMax, REDUCE_MIN)) {
+        FragColor = vec4(center, 1.0);
+        return;
+    }
+
+    // the gradient of the corners gives the direction perpendicular to the edge, blur along the edge
+    vec2 direction = vec2(-((lumaNW + lumaNE) - (lumaSW + lumaSE)), (lumaNW + lumaSW) - (lumaNE + lumaSE));
+
+    float directionReduce = max((lumaNW + lumaNE + lumaSW + lumaSE) * 0.25 * REDUCE_MUL, REDUCE_MIN);
+    float inverseSmallest = 1.0 / (min(abs(direction.x), abs(direction.y)) + directionReduce);
+
+    direction = clamp(direction * inverseSmallest, vec2(-SPAN_MAX), vec2(SPAN_MAX)) * texelSize;
+
+    // two taps close to the pixel and two further away along the edge
+    vec3 colorA = 0.5 * (sampleScreen(TexCoords + direction * (1.0 / 3.0 - 0.5)) +
+                         sampleScreen(TexCoords + direction * (2.0 / 3.0 - 0.5)));
+    vec3 colorB = colorA * 0.5 + 0.25 * (sampleScreen(TexCoords + direction * -0.5) +
+                                         sampleScreen(TexCoords + direction * 0.5));
+
+    // the wide blur is only kept when it doesn't overshoot the local contrast range
+    float lumaB = luma(colorB);
+
+    if (lumaB < lumaMin || lumaB > lumaMax) {
+        FragColor = vec4(colorA, 1.0);
+    }
+    else {
+        FragColor = vec4(colorB, 1.0);
+    }
+}
@@ -0,0 +1,14 @@
+#version 330 core
+
+layout (location = 0) in vec2 vertex ;
+layout (location = 1) in vec2 uv ;
+
+// part of the texture the scene was rendered to (dynamic resolution)
+uniform vec2 uvScale ;
+
+out vec2 TexCoords;
+
+void main() {
+    gl_Position = vec4(vertex.x, vertex.y, 0.0, 1.0);
+    TexCoords = uv * uvScale;
+}
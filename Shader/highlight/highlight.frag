@@ -1,7 +1,7 @@
-#version 440 compatibility
-
-out vec3 finalColor;
-
-void main() {
-  finalColor = vec3(1.0, 0.2, 0.0);
+#version 440 compatibility
+
+out vec3 finalColor;
+
+void main() {
+  finalColor = vec3(1.0, 0.2, 0.0);
 }
\ No newline at end of file
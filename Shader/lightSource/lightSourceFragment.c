@@ -1,7 +1,7 @@
-#version 440 compatibility
-
-out vec3 finalColor;
-
-void main() {
-  finalColor = vec3(1.0, 1.0, 1.0);
-}
+#version 440 compatibility
+
+out vec3 finalColor;
+
+void main() {
+  finalColor = vec3(1.0, 1.0, 1.0);
+}
@@ -0,0 +1,67 @@
+#version 440 compatibility
+#extension GL_ARB_bindless_texture : enable
+#pragma features TEXTURED
+
+in vec2 uvs;
+in vec3 fragNormal;
+in vec3 fragLightPosition;
+in vec3 fragPosition;
+in vec3 fragEyePosition;
+
+out vec3 outColor;
+
+#ifdef TEXTURED
+flat in int material;
+
+// material textures: a bindless handle when the driver has them, otherwise a layer of one of the texture arrays
+struct material_t {
+  uvec2 handle;
+  int array;
+  int layer;
+};
+
+layout (std430, binding = 3) readonly buffer materialBuffer {
+  material_t materials[];
+};
+
+layout (binding = 8) uniform sampler2DArray materialArrays[4];
+
+vec4 sampleMaterial(vec2 uv) {
+  if (material < 0) {
+    return(vec4(1.0));
+  }
+
+#ifdef GL_ARB_bindless_texture
+  return(texture(sampler2D(materials[material].handle), uv));
+#else
+  return(texture(materialArrays[materials[material].array], vec3(uv, materials[material].layer)));
+#endif
+}
+#endif
+
+void main() {
+  vec3 lightColor = vec3(1.0, 1.0, 1.0);
+  float ambientStrength = 0.2;
+
+  vec3 ambient = ambientStrength * lightColor;
+
+  vec3 norm = normalize(fragNormal);
+  vec3 lightDirection = normalize(fragLightPosition - fragPosition);
+
+  float diff = max(dot(norm, lightDirection), 0.0);
+  vec3 diffuse = diff * lightColor;
+
+  float specularStrength = 1;
+  vec3 viewDir = normalize(fragEyePosition - fragPosition);
+  vec3 reflectDir = reflect(-lightDirection, norm);
+
+  float spec = pow(max(dot(viewDir, reflectDir), 0.0), 64);
+
+  vec3 specular = specularStrength * spec * lightColor;
+
+#ifdef TEXTURED
+  outColor = (ambient + diffuse + specular) * sampleMaterial(uvs).rgb;
+#else
+  outColor = ambient + diffuse + specular;
+#endif
+}
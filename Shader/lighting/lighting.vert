@@ -1,33 +1,43 @@
-#version 440 compatibility
-
-layout (location = 0) in vec3 vertex ;
-layout (location = 1) in vec2 uv ;
-layout (location = 2) in vec3 normal ;
-
-out vec2 uvs;
-out vec3 fragNormal;
-out vec3 fragLightPosition;
-out vec3 fragPosition;
-out vec3 fragEyePosition;
-
-uniform mat4 modelMatrix ;
-uniform mat4 viewMatrix ;
-uniform mat4 projectionMatrix ;
-uniform vec3 lightPosition ;
-uniform vec3 eyePosition ;
-
-void main() {
-  gl_Position = projectionMatrix * viewMatrix * modelMatrix * vec4(vertex, 1);
-
-  uvs = uv;
-
-  fragNormal = mat3(transpose(inverse(modelMatrix))) * normal;
-
-  // fragNormal = normal;
-
-  fragLightPosition = lightPosition;
-
-  fragPosition = vec3(modelMatrix * vec4(vertex, 1.0));
-
-  fragEyePosition = eyePosition;
-}
+#version 440 compatibility
+#pragma features TEXTURED
+
+layout (location = 0) in vec3 vertex ;
+layout (location = 1) in vec2 uv ;
+layout (location = 2) in vec3 normal ;
+
+out vec2 uvs;
+out vec3 fragNormal;
+out vec3 fragLightPosition;
+out vec3 fragPosition;
+out vec3 fragEyePosition;
+
+uniform mat4 modelMatrix ;
+uniform mat4 viewMatrix ;
+uniform mat4 projectionMatrix ;
+uniform vec3 lightPosition ;
+uniform vec3 eyePosition ;
+
+// textured variant: the index of the entity texture in the material buffer
+#ifdef TEXTURED
+flat out int material;
+
+uniform int materialIndex ;
+#endif
+
+void main() {
+  gl_Position = projectionMatrix * viewMatrix * modelMatrix * vec4(vertex, 1);
+
+  uvs = uv;
+
+#ifdef TEXTURED
+  material = materialIndex;
+#endif
+
+  fragNormal = mat3(transpose(inverse(modelMatrix))) * normal;
+
+  fragLightPosition = lightPosition;
+
+  fragPosition = vec3(modelMatrix * vec4(vertex, 1.0));
+
+  fragEyePosition = eyePosition;
+}
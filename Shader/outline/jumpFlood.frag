@@ -0,0 +1,43 @@
+#version 330 core
+
+// one step of the jump flood: every texel keeps the closest seed found among itself and the 8 texels stepSize away
+
+layout (location = 0) out ivec2 seed;
+
+in vec2 TexCoords;
+
+uniform isampler2D seedTexture;
+uniform int stepSize;
+// part of the target that's being used
+uniform ivec2 size;
+
+void main() {
+    ivec2 texel = ivec2(gl_FragCoord.xy);
+
+    ivec2 closest = ivec2(-1);
+    int closestDistance = 0x7fffffff;
+
+    for (int y = -1; y <= 1; y++) {
+        for (int x = -1; x <= 1; x++) {
+            ivec2 neighbour = texel + ivec2(x, y) * stepSize;
+
+            if (any(lessThan(neighbour, ivec2(0))) || any(greaterThanEqual(neighbour, size))) {
+                continue;
+            }
+
+            ivec2 candidate = texelFetch(seedTexture, neighbour, 0).xy;
+
+            if (candidate.x >= 0) {
+                ivec2 offset = candidate - texel;
+                int distance = offset.x * offset.x + offset.y * offset.y;
+
+                if (distance < closestDistance) {
+                    closestDistance = distance;
+                    closest = candidate;
+                }
+            }
+        }
+    }
+
+    seed = closest;
+}
@@ -1,50 +1,49 @@
-#version 330 core
-
-out vec4 FragColor;
-
-in vec2 TexCoords;
-
-uniform sampler2D screenTexture;
-uniform sampler2D outlineMask;
-
-
-float map(float x, float in_min, float in_max, float out_min, float out_max) {
-  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
-}
-
-
-void main() {
-    int size = 5;
-    ivec2 texSize = textureSize(screenTexture, 0);
-    ivec2 newTexCoord = ivec2(TexCoords.x * texSize.x, TexCoords.y * texSize.y);
-    vec4 color = vec4(0.0);
-
-    float threshold = 0.01;
-
-    bool hit = false;
-
-    if (texelFetch(outlineMask, newTexCoord, 0).x <= 0.5) {
-        for (int i = -size; i < size && !hit; i++) {
-            for (int j = -size; j < size && !hit; j++) {
-                float dist = sqrt(pow(i, 2) + pow(j, 2));
-                if (dist <= size + size * threshold && dist >= size - size * threshold) {
-                    if (texelFetch(outlineMask, ivec2(newTexCoord.x + i, newTexCoord.y + j), 0).x >= 0.5) {
-                        hit = true;
-                    }
-                }   
-            }
-        }
-    }
-
-    if (hit == true) {
-//        FragColor = vec4(1.0, 0.2, 0.0, 1.0);
-        float r = map(209, 0, 255, 0, 1);
-        float g = map(154, 0, 255, 0, 1);
-        float b = map(102, 0, 255, 0, 1);
-//        FragColor = vec4(1.0, 0.2, 0.0, 1.0);
-        FragColor = vec4(r, g, b, 1.0);
-        
-    } else {
-        FragColor = texelFetch(screenTexture, newTexCoord, 0);
-    }
-}
+#version 330 core
+#pragma features FADE
+
+// outline of the selected entity, blended over the image: the distance to the entity is read from the jump flood
+// result, so the cost doesn't depend on the width of the outline or on the mesh
+
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+uniform usampler2DMS idTexture;
+uniform isampler2D seedTexture;
+uniform uint selectedID;
+uniform int downsample;
+// width of the outline in pixels
+uniform float width;
+uniform vec3 color;
+
+void main() {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+
+    // the entity itself isn't covered
+    if (texelFetch(idTexture, pixel, 0).r == selectedID) {
+        discard;
+    }
+
+    ivec2 seed = texelFetch(seedTexture, pixel / downsample, 0).xy;
+
+    if (seed.x < 0) {
+        discard;
+    }
+
+    // distance from the border of the closest reduced resolution texel of the entity
+    vec2 seedCenter = (vec2(seed) + 0.5) * float(downsample);
+    float distance = max(length(seedCenter - gl_FragCoord.xy) - 0.5 * float(downsample), 0.0);
+
+    // solid, or fading with the distance (FADE)
+#ifdef FADE
+    float alpha = clamp(1.0 - distance / width, 0.0, 1.0);
+#else
+    float alpha = clamp(width - distance + 0.5, 0.0, 1.0);
+#endif
+
+    if (alpha <= 0.0) {
+        discard;
+    }
+
+    FragColor = vec4(color, alpha);
+}
@@ -0,0 +1,29 @@
+#version 330 core
+
+// seeds of the jump flood: every reduced resolution texel covering a pixel of the selected entity points to itself
+
+layout (location = 0) out ivec2 seed;
+
+in vec2 TexCoords;
+
+// stencil of the forward pass, holding the id of the entity drawn on every pixel
+uniform usampler2DMS idTexture;
+uniform uint selectedID;
+uniform int downsample;
+
+void main() {
+    ivec2 texel = ivec2(gl_FragCoord.xy);
+    ivec2 last = textureSize(idTexture) - 1;
+
+    seed = ivec2(-1);
+
+    for (int y = 0; y < downsample; y++) {
+        for (int x = 0; x < downsample; x++) {
+            ivec2 pixel = min(texel * downsample + ivec2(x, y), last);
+
+            if (texelFetch(idTexture, pixel, 0).r == selectedID) {
+                seed = texel;
+            }
+        }
+    }
+}
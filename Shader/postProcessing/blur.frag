@@ -0,0 +1,28 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+uniform sampler2D screenTexture;
+// last uv inside the input area
+uniform vec2 uvMax;
+// one texel along the blur axis, in uv
+uniform vec2 direction;
+
+// gaussian kernel computed on the cpu, neighbouring weights are merged into a single bilinear tap
+// (offsets in texels, the first tap is the center)
+uniform int taps;
+uniform float weights[17];
+uniform float offsets[17];
+
+void main() {
+    vec3 color = texture(screenTexture, min(TexCoords, uvMax)).rgb * weights[0];
+
+    for (int i = 1; i < taps; i++) {
+        color += texture(screenTexture, min(TexCoords + direction * offsets[i], uvMax)).rgb * weights[i];
+        color += texture(screenTexture, min(TexCoords - direction * offsets[i], uvMax)).rgb * weights[i];
+    }
+
+    FragColor = vec4(color, 1.0);
+}
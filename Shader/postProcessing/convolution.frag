@@ -0,0 +1,27 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+uniform sampler2D screenTexture;
+// last uv inside the input area
+uniform vec2 uvMax;
+// size of one texel in uv
+uniform vec2 texelSize;
+
+// 3x3 kernel computed on the cpu, top left to bottom right
+uniform float kernel[9];
+
+void main() {
+    vec3 color = vec3(0.0);
+
+    for (int y = 0; y < 3; y++) {
+        for (int x = 0; x < 3; x++) {
+            vec2 offset = vec2(x - 1, 1 - y) * texelSize;
+            color += texture(screenTexture, min(TexCoords + offset, uvMax)).rgb * kernel[y * 3 + x];
+        }
+    }
+
+    FragColor = vec4(clamp(color, 0.0, 1.0), 1.0);
+}
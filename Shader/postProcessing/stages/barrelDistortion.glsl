@@ -0,0 +1,14 @@
+// barrel distortion of the view, parameters.x is the power the distance from the center is raised to
+vec2 barrelDistortion(vec2 uv, vec4 parameters) {
+    vec2 xy = 2.0 * uv - 1.0;
+    float radius = length(xy);
+
+    if (radius >= 1.0) {
+        return uv;
+    }
+
+    float theta = atan(xy.y, xy.x);
+    radius = pow(radius, parameters.x);
+
+    return 0.5 * (vec2(radius * cos(theta), radius * sin(theta)) + 1.0);
+}
@@ -0,0 +1,4 @@
+// color filter, parameters.rgb is the color the image is multiplied by
+vec3 colorFilter(vec3 color, vec2 uv, vec4 parameters) {
+    return color * parameters.rgb;
+}
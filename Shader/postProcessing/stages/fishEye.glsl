@@ -0,0 +1,19 @@
+// fish eye lens, parameters.x is the aperture in degrees
+vec2 fishEye(vec2 uv, vec4 parameters) {
+    float apertureHalf = 0.5 * parameters.x * (PI / 180.0);
+    float maxFactor = sin(apertureHalf);
+
+    vec2 xy = 2.0 * uv - 1.0;
+    float d = length(xy);
+
+    if (d >= (2.0 - maxFactor)) {
+        return uv;
+    }
+
+    d = length(xy * maxFactor);
+    float z = sqrt(1.0 - d * d);
+    float r = atan(d, z) / PI;
+    float phi = atan(xy.y, xy.x);
+
+    return vec2(r * cos(phi) + 0.5, r * sin(phi) + 0.5);
+}
@@ -0,0 +1,4 @@
+// inverted colors
+vec3 invert(vec3 color, vec2 uv, vec4 parameters) {
+    return 1.0 - color;
+}
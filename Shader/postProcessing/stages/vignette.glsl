@@ -0,0 +1,5 @@
+// black fade towards the borders of the view, parameters.x is the strength
+vec3 vignette(vec3 color, vec2 uv, vec4 parameters) {
+    float dist = length(uv - 0.5);
+    return color * clamp(1.0 - dist * parameters.x, 0.0, 1.0);
+}
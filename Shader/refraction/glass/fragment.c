@@ -1,16 +1,17 @@
-#version 330 core
-out vec4 FragColor;
-
-in vec3 Normal;
-in vec3 Position;
-in vec3 cameraPos;
-
-
-uniform samplerCube skybox;
-
-void main() {
-  float ratio = 1.00 / 1.52;
-  vec3 I = normalize(Position - cameraPos);
-  vec3 R = refract(I, normalize(Normal), ratio);
-  FragColor = vec4(texture(skybox, R).rgb, 1.0) * vec4(0.8, 1.0, 0.8, 1);
-}
+#version 440 core
+out vec4 FragColor;
+
+in vec3 Normal;
+in vec3 Position;
+in vec3 cameraPos;
+
+
+// environment cubemap, bound once per pass (ENVIRONMENT_TEXTURE_UNIT)
+layout (binding = 7) uniform samplerCube skybox;
+
+void main() {
+  float ratio = 1.00 / 1.52;
+  vec3 I = normalize(Position - cameraPos);
+  vec3 R = refract(I, normalize(Normal), ratio);
+  FragColor = vec4(texture(skybox, R).rgb, 1.0) * vec4(0.8, 1.0, 0.8, 1);
+}
@@ -1,11 +1,36 @@
-#version 330 core
-
-in vec2 texcoord;
-
-out vec3 color;
-
-uniform sampler2D texture0;
-
-void main(){
-  color = texture(texture0, texcoord).rgb;
-}
+#version 440 core
+#extension GL_ARB_bindless_texture : enable
+
+in vec2 texcoord;
+flat in int material;
+
+out vec3 color;
+
+// material textures: a bindless handle when the driver has them, otherwise a layer of one of the texture arrays
+struct material_t {
+  uvec2 handle;
+  int array;
+  int layer;
+};
+
+layout (std430, binding = 3) readonly buffer materialBuffer {
+  material_t materials[];
+};
+
+layout (binding = 8) uniform sampler2DArray materialArrays[4];
+
+vec4 sampleMaterial(vec2 uv) {
+  if (material < 0) {
+    return(vec4(1.0));
+  }
+
+#ifdef GL_ARB_bindless_texture
+  return(texture(sampler2D(materials[material].handle), uv));
+#else
+  return(texture(materialArrays[materials[material].array], vec3(uv, materials[material].layer)));
+#endif
+}
+
+void main(){
+  color = sampleMaterial(texcoord).rgb;
+}
@@ -1,9 +1,9 @@
-#version 440 compatibility
-
-in vec3 fragmentColor;
-
-out vec3 color;
-
-void main(){
-  color = fragmentColor;
-}
+#version 440 compatibility
+
+in vec3 fragmentColor;
+
+out vec3 color;
+
+void main(){
+  color = fragmentColor;
+}
@@ -0,0 +1,48 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+// half resolution reflection (rgb) and reflectivity (a)
+uniform sampler2D reflectionTexture;
+// level 0 holds the full resolution depth, level 1 matches the reflection resolution
+uniform sampler2D hiZTexture;
+
+uniform mat4 inverseProjectionMatrix;
+// size of the traced area of reflectionTexture
+uniform ivec2 reflectionSize;
+
+float linearDepth(float depth) {
+    vec4 position = inverseProjectionMatrix * vec4(0.0, 0.0, depth * 2.0 - 1.0, 1.0);
+    return -position.z / position.w;
+}
+
+void main() {
+    float depth = linearDepth(texelFetch(hiZTexture, ivec2(gl_FragCoord.xy), 0).r);
+
+    ivec2 halfSize = reflectionSize;
+    vec2 position = gl_FragCoord.xy * 0.5 - 0.5;
+    ivec2 base = ivec2(floor(position));
+    vec2 fraction = position - vec2(base);
+
+    vec4 color = vec4(0.0);
+    float totalWeight = 0.0;
+
+    // bilinear upsample where every tap is weighted down when its depth doesn't match,
+    // this keeps reflections from bleeding over silhouettes
+    for (int y = 0; y <= 1; y++) {
+        for (int x = 0; x <= 1; x++) {
+            ivec2 coord = clamp(base + ivec2(x, y), ivec2(0), halfSize - 1);
+
+            float bilinear = (x == 0 ? 1.0 - fraction.x : fraction.x) * (y == 0 ? 1.0 - fraction.y : fraction.y);
+            float tapDepth = linearDepth(texelFetch(hiZTexture, coord, 1).r);
+            float weight = bilinear / (0.001 + abs(depth - tapDepth) / depth);
+
+            color += texelFetch(reflectionTexture, coord, 0) * weight;
+            totalWeight += weight;
+        }
+    }
+
+    FragColor = color / max(totalWeight, 1e-5);
+}
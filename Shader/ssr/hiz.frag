@@ -0,0 +1,49 @@
+#version 330 core
+
+out float FragDepth;
+
+in vec2 TexCoords;
+
+// resolved single sample depth buffer, only read when building level 0
+uniform sampler2D depthTexture;
+// the hierarchical depth texture itself, only the previous level is readable while building the next one
+uniform sampler2D hiZTexture;
+uniform int previousLevel;
+
+void main() {
+    ivec2 coord = ivec2(gl_FragCoord.xy);
+
+    if (previousLevel < 0) {
+        FragDepth = texelFetch(depthTexture, coord, 0).r;
+        return;
+    }
+
+    // every texel keeps the closest depth of the 2x2 block below it,
+    // odd sized levels also fold in the extra row / column so no texel is skipped
+    ivec2 previousSize = textureSize(hiZTexture, previousLevel);
+    ivec2 source = coord * 2;
+
+    float depth = texelFetch(hiZTexture, source, previousLevel).r;
+    depth = min(depth, texelFetch(hiZTexture, source + ivec2(1, 0), previousLevel).r);
+    depth = min(depth, texelFetch(hiZTexture, source + ivec2(0, 1), previousLevel).r);
+    depth = min(depth, texelFetch(hiZTexture, source + ivec2(1, 1), previousLevel).r);
+
+    bool oddWidth = (previousSize.x & 1) != 0 && source.x + 2 == previousSize.x - 1;
+    bool oddHeight = (previousSize.y & 1) != 0 && source.y + 2 == previousSize.y - 1;
+
+    if (oddWidth) {
+        depth = min(depth, texelFetch(hiZTexture, source + ivec2(2, 0), previousLevel).r);
+        depth = min(depth, texelFetch(hiZTexture, source + ivec2(2, 1), previousLevel).r);
+    }
+
+    if (oddHeight) {
+        depth = min(depth, texelFetch(hiZTexture, source + ivec2(0, 2), previousLevel).r);
+        depth = min(depth, texelFetch(hiZTexture, source + ivec2(1, 2), previousLevel).r);
+    }
+
+    if (oddWidth && oddHeight) {
+        depth = min(depth, texelFetch(hiZTexture, source + ivec2(2, 2), previousLevel).r);
+    }
+
+    FragDepth = depth;
+}
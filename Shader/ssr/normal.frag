@@ -0,0 +1,12 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec3 viewNormal;
+
+// how much of the reflection ends up on the surface, 0 means the pixel is not traced at all
+uniform float reflectivity;
+
+void main() {
+    FragColor = vec4(normalize(viewNormal), reflectivity);
+}
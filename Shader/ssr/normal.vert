@@ -0,0 +1,15 @@
+#version 330 core
+
+layout (location = 0) in vec3 vertex ;
+layout (location = 2) in vec3 normal ;
+
+out vec3 viewNormal;
+
+uniform mat4 modelMatrix ;
+uniform mat4 viewMatrix ;
+uniform mat4 projectionMatrix ;
+
+void main() {
+    viewNormal = mat3(transpose(inverse(viewMatrix * modelMatrix))) * normal;
+    gl_Position = projectionMatrix * viewMatrix * modelMatrix * vec4(vertex, 1.0);
+}
@@ -0,0 +1,141 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+uniform sampler2D hiZTexture;
+uniform sampler2D normalTexture;
+uniform sampler2D colorTexture;
+uniform samplerCube skybox;
+
+uniform mat4 projectionMatrix;
+uniform mat4 inverseProjectionMatrix;
+uniform mat4 inverseViewMatrix;
+
+uniform int maxLevel;
+uniform int maxSteps;
+uniform float maxDistance;
+uniform float thickness;
+// part of the textures covered by the rendered image (dynamic resolution), screen uvs are scaled by it to sample them
+uniform vec2 viewportScale;
+
+// reconstruct the view space position from a screen uv and a depth buffer value
+vec3 viewPosition(vec2 uv, float depth) {
+    vec4 position = inverseProjectionMatrix * vec4(vec3(uv, depth) * 2.0 - 1.0, 1.0);
+    return position.xyz / position.w;
+}
+
+// project a view space position to (uv, depth), the same space the hierarchical depth lives in
+vec3 screenPosition(vec3 position) {
+    vec4 clip = projectionMatrix * vec4(position, 1.0);
+    return clip.xyz / clip.w * 0.5 + 0.5;
+}
+
+// ray parameter needed to leave the current cell of a mip level
+float cellExit(vec2 position, vec2 direction, vec2 cellCount) {
+    vec2 cell = floor(position * cellCount);
+    vec2 boundary = (cell + step(0.0, direction)) / cellCount;
+    vec2 safeDirection = mix(direction, vec2(1e-6), lessThan(abs(direction), vec2(1e-6)));
+    vec2 toBoundary = (boundary - position) / safeDirection;
+    return min(toBoundary.x, toBoundary.y);
+}
+
+void main() {
+    vec2 texCoord = TexCoords * viewportScale;
+    vec4 surface = textureLod(normalTexture, texCoord, 0);
+
+    // pixels that don't belong to a reflective shader are left alone
+    if (surface.a <= 0.0) {
+        FragColor = vec4(0.0);
+        return;
+    }
+
+    float depth = textureLod(hiZTexture, texCoord, 0).r;
+    vec3 position = viewPosition(TexCoords, depth);
+    vec3 normal = normalize(surface.xyz);
+    vec3 reflected = normalize(reflect(normalize(position), normal));
+
+    // what the surface sees when the ray leaves the screen or goes behind everything
+    vec3 fallback = texture(skybox, mat3(inverseViewMatrix) * reflected).rgb;
+
+    // rays coming back towards the camera are clipped right before the near plane
+    float nearPlane = -viewPosition(vec2(0.5), 0.0).z;
+    float rayLength = maxDistance;
+    if (position.z + reflected.z * rayLength > -nearPlane) {
+        rayLength = (-nearPlane - position.z) / reflected.z;
+    }
+
+    // the ray is marched in texture uvs, where the hierarchical depth cells are
+    vec3 end = screenPosition(position + reflected * rayLength);
+    vec3 start = vec3(texCoord, depth);
+    vec3 direction = vec3(end.xy * viewportScale, end.z) - start;
+
+    // step one full resolution texel away from the surface to avoid hitting itself
+    vec2 fullSize = vec2(textureSize(hiZTexture, 0));
+    float t = 2.0 / (max(length(direction.xy * fullSize), 1e-4));
+
+    int level = 0;
+    bool hit = false;
+    vec2 hitCoord = vec2(0.0);
+
+    for (int i = 0; i < maxSteps && t <= 1.0; i++) {
+        vec3 ray = start + direction * t;
+
+        if (any(lessThan(ray.xy, vec2(0.0))) || any(greaterThan(ray.xy, viewportScale))) {
+            break;
+        }
+
+        vec2 cellCount = vec2(textureSize(hiZTexture, level));
+        float crossStep = 0.01 / (max(cellCount.x, cellCount.y) * max(length(direction.xy), 1e-4));
+        float cellEnd = t + cellExit(ray.xy, direction.xy, cellCount) + crossStep;
+
+        float cellDepth = texelFetch(hiZTexture, ivec2(ray.xy * cellCount), level).r;
+        // deepest point of the ray inside this cell
+        float rayDepth = max(ray.z, start.z + direction.z * cellEnd);
+
+        if (rayDepth < cellDepth) {
+            // the whole segment is in front of the closest surface of the cell: skip it and go coarser
+            t = cellEnd;
+            level = min(level + 1, maxLevel);
+        }
+        else if (level > 0) {
+            // something in the cell could be hit, refine
+            level--;
+        }
+        else {
+            // full resolution crossing, move to where the ray actually meets the surface
+            float crossing = t;
+            if (abs(direction.z) > 1e-7) {
+                crossing = clamp((cellDepth - start.z) / direction.z, t, cellEnd);
+            }
+
+            vec3 contact = start + direction * crossing;
+
+            // reject crossings where the ray passes far behind a thin object
+            float surfaceDistance = -viewPosition(contact.xy / viewportScale, cellDepth).z;
+            float rayDistance = -viewPosition(contact.xy / viewportScale, contact.z).z;
+
+            if (rayDistance - surfaceDistance < thickness) {
+                hit = true;
+                hitCoord = contact.xy;
+                break;
+            }
+
+            t = cellEnd;
+        }
+    }
+
+    vec3 color = fallback;
+
+    if (hit) {
+        // fade out towards the screen borders and the end of the ray, where the trace becomes unreliable
+        vec2 screenCoord = hitCoord / viewportScale;
+        vec2 edge = smoothstep(0.0, 0.08, screenCoord) * (1.0 - smoothstep(0.92, 1.0, screenCoord));
+        float confidence = edge.x * edge.y * (1.0 - smoothstep(0.8, 1.0, t));
+
+        color = mix(fallback, textureLod(colorTexture, hitCoord, 0).rgb, confidence);
+    }
+
+    FragColor = vec4(color, surface.a);
+}
@@ -0,0 +1,11 @@
+#version 330 core
+
+out vec2 FragColor;
+
+in vec4 currentPosition;
+in vec4 previousPosition;
+
+void main() {
+    // screen uv offset between this frame and the last one
+    FragColor = (currentPosition.xy / currentPosition.w - previousPosition.xy / previousPosition.w) * 0.5;
+}
@@ -0,0 +1,20 @@
+#version 330 core
+
+layout (location = 0) in vec3 vertex ;
+
+// where the vertex is this frame and where it was last frame, both seen through last frame's camera,
+// so their difference is only the motion of the entity itself
+out vec4 currentPosition;
+out vec4 previousPosition;
+
+uniform mat4 modelMatrix ;
+uniform mat4 viewMatrix ;
+uniform mat4 projectionMatrix ;
+uniform mat4 previousModelMatrix ;
+uniform mat4 previousViewProjection ;
+
+void main() {
+    currentPosition = previousViewProjection * modelMatrix * vec4(vertex, 1.0);
+    previousPosition = previousViewProjection * previousModelMatrix * vec4(vertex, 1.0);
+    gl_Position = projectionMatrix * viewMatrix * modelMatrix * vec4(vertex, 1.0);
+}
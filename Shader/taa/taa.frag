@@ -0,0 +1,84 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+// resolved frame, depth and entity motion, rendered in the bottom left renderSize texels
+uniform sampler2D currentTexture;
+uniform sampler2D depthTexture;
+uniform sampler2D velocityTexture;
+// accumulated output of the previous frames, at the output resolution in the bottom left of the texture
+uniform sampler2D historyTexture;
+// part of the history texture covered by the output, and the last uv inside it
+uniform vec2 historyScale;
+uniform vec2 historyMax;
+
+uniform vec2 renderSize;
+// offset of this frame's image in render pixels, coming from the projection jitter
+uniform vec2 jitter;
+uniform mat4 inverseViewProjection;
+uniform mat4 previousViewProjection;
+// weight of the current frame when it's sampled right on the output pixel
+uniform float feedback;
+uniform bool resetHistory;
+
+// clamping happens in luma / chroma space, where the neighbourhood box is tighter around the real colors
+vec3 toYCoCg(vec3 color) {
+    return vec3(dot(color, vec3(0.25, 0.5, 0.25)), dot(color, vec3(0.5, 0.0, -0.5)), dot(color, vec3(-0.25, 0.5, -0.25)));
+}
+
+vec3 fromYCoCg(vec3 color) {
+    return vec3(color.x + color.y - color.z, color.x + color.z, color.x - color.y - color.z);
+}
+
+void main() {
+    // position of the output pixel on the render grid, shifted like this frame's image
+    vec2 renderPosition = TexCoords * renderSize + jitter;
+    ivec2 center = clamp(ivec2(floor(renderPosition)), ivec2(0), ivec2(renderSize) - 1);
+
+    // color range of the neighbourhood and the closest surface in it, whose motion is used so edges move with the object
+    vec3 minColor = vec3(1e5);
+    vec3 maxColor = vec3(-1e5);
+    float closestDepth = 1.0;
+    ivec2 closestCoord = center;
+
+    for (int y = -1; y <= 1; y++) {
+        for (int x = -1; x <= 1; x++) {
+            ivec2 coord = clamp(center + ivec2(x, y), ivec2(0), ivec2(renderSize) - 1);
+            vec3 color = toYCoCg(texelFetch(currentTexture, coord, 0).rgb);
+
+            minColor = min(minColor, color);
+            maxColor = max(maxColor, color);
+
+            float depth = texelFetch(depthTexture, coord, 0).r;
+
+            if (depth < closestDepth) {
+                closestDepth = depth;
+                closestCoord = coord;
+            }
+        }
+    }
+
+    vec3 current = toYCoCg(texelFetch(currentTexture, center, 0).rgb);
+
+    // camera motion comes from reprojecting the depth, the motion of the entities is added on top
+    vec4 position = inverseViewProjection * vec4(vec3(TexCoords, closestDepth) * 2.0 - 1.0, 1.0);
+    vec4 previous = previousViewProjection * vec4(position.xyz / position.w, 1.0);
+    vec2 previousCoord = previous.xy / previous.w * 0.5 + 0.5;
+    previousCoord -= texelFetch(velocityTexture, closestCoord, 0).rg;
+
+    if (resetHistory || any(lessThan(previousCoord, vec2(0.0))) || any(greaterThan(previousCoord, vec2(1.0)))) {
+        FragColor = vec4(fromYCoCg(current), 1.0);
+        return;
+    }
+
+    // history that falls outside of what the neighbourhood could look like is stale (disocclusion, lighting change)
+    vec3 history = clamp(toYCoCg(texture(historyTexture, min(previousCoord * historyScale, historyMax)).rgb), minColor, maxColor);
+
+    // samples far from the output pixel (only when upsampling, or with a large jitter) count less
+    vec2 offset = renderPosition - (vec2(center) + 0.5);
+    float weight = exp(-2.29 * dot(offset, offset));
+
+    FragColor = vec4(fromYCoCg(mix(history, current, clamp(feedback * weight, 0.0, 1.0))), 1.0);
+}
@@ -0,0 +1,37 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+// upsampled image, in the bottom left size texels
+uniform sampler2D screenTexture;
+uniform ivec2 size;
+// 0 is the lightest sharpening, 1 the strongest
+uniform float sharpness;
+
+void main() {
+    ivec2 coord = ivec2(gl_FragCoord.xy);
+    ivec2 maxCoord = size - 1;
+
+    //   b
+    // d e f
+    //   h
+    vec3 b = texelFetch(screenTexture, clamp(coord + ivec2(0, -1), ivec2(0), maxCoord), 0).rgb;
+    vec3 d = texelFetch(screenTexture, clamp(coord + ivec2(-1, 0), ivec2(0), maxCoord), 0).rgb;
+    vec3 e = texelFetch(screenTexture, coord, 0).rgb;
+    vec3 f = texelFetch(screenTexture, clamp(coord + ivec2(1, 0), ivec2(0), maxCoord), 0).rgb;
+    vec3 h = texelFetch(screenTexture, clamp(coord + ivec2(0, 1), ivec2(0), maxCoord), 0).rgb;
+
+    vec3 minColor = min(min(min(b, d), min(e, f)), h);
+    vec3 maxColor = max(max(max(b, d), max(e, f)), h);
+
+    // contrast adaptive: the closer the neighbourhood already is to black or white, the less it's sharpened,
+    // so the result never clips
+    vec3 amount = sqrt(clamp(min(minColor, 1.0 - maxColor) / max(maxColor, vec3(1e-4)), 0.0, 1.0));
+    vec3 weight = amount * (-1.0 / mix(8.0, 5.0, sharpness));
+
+    vec3 color = ((b + d + f + h) * weight + e) / (1.0 + 4.0 * weight);
+
+    FragColor = vec4(clamp(color, 0.0, 1.0), 1.0);
+}
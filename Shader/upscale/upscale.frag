@@ -0,0 +1,99 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+// reduced resolution image, rendered in the bottom left renderSize texels
+uniform sampler2D screenTexture;
+uniform vec2 renderSize;
+
+float luma(vec3 color) {
+    return dot(color, vec3(0.299, 0.587, 0.114));
+}
+
+vec3 fetch(ivec2 coord) {
+    return texelFetch(screenTexture, clamp(coord, ivec2(0), ivec2(renderSize) - 1), 0).rgb;
+}
+
+// polynomial approximation of a lanczos 2 lobe on the squared distance, lobe goes from 1/4 (lanczos 2)
+// to 1/2 (softer, no ringing), the kernel ends at a squared distance of 1 / lobe
+float lanczos2(float distance2, float lobe) {
+    distance2 = min(distance2, 1.0 / lobe);
+    float base = 2.0 / 5.0 * distance2 - 1.0;
+    float window = lobe * distance2 - 1.0;
+    return (25.0 / 16.0 * base * base - (25.0 / 16.0 - 1.0)) * window * window;
+}
+
+void main() {
+    // output pixel on the input grid, relative to the center of the texel at its top left
+    vec2 position = TexCoords * renderSize - 0.5;
+    ivec2 base = ivec2(floor(position));
+    vec2 fraction = position - vec2(base);
+
+    // 12 taps: the 2x2 around the pixel (f g j k) and the two texels beyond each of their sides
+    //     b c
+    //   e f g h
+    //   i j k l
+    //     n o
+    vec3 b = fetch(base + ivec2(0, -1));
+    vec3 c = fetch(base + ivec2(1, -1));
+    vec3 e = fetch(base + ivec2(-1, 0));
+    vec3 f = fetch(base + ivec2(0, 0));
+    vec3 g = fetch(base + ivec2(1, 0));
+    vec3 h = fetch(base + ivec2(2, 0));
+    vec3 i = fetch(base + ivec2(-1, 1));
+    vec3 j = fetch(base + ivec2(0, 1));
+    vec3 k = fetch(base + ivec2(1, 1));
+    vec3 l = fetch(base + ivec2(2, 1));
+    vec3 n = fetch(base + ivec2(0, 2));
+    vec3 o = fetch(base + ivec2(1, 2));
+
+    float lb = luma(b), lc = luma(c), le = luma(e), lf = luma(f), lg = luma(g), lh = luma(h);
+    float li = luma(i), lj = luma(j), lk = luma(k), ll = luma(l), ln = luma(n), lo = luma(o);
+
+    // luma gradient of the 2x2, interpolated at the pixel position
+    vec2 gradient = vec2(lg - le, lj - lb) * (1.0 - fraction.x) * (1.0 - fraction.y) +
+                    vec2(lh - lf, lk - lc) * fraction.x * (1.0 - fraction.y) +
+                    vec2(lk - li, ln - lf) * (1.0 - fraction.x) * fraction.y +
+                    vec2(ll - lj, lo - lg) * fraction.x * fraction.y;
+
+    float lumaMin = min(min(min(lb, lc), min(le, lf)), min(min(lg, lh), min(min(li, lj), min(min(lk, ll), min(ln, lo)))));
+    float lumaMax = max(max(max(lb, lc), max(le, lf)), max(max(lg, lh), max(max(li, lj), max(max(lk, ll), max(ln, lo)))));
+
+    // how much the neighbourhood looks like a single edge, 0 in flat or noisy areas
+    float edge = clamp(length(gradient) / max(lumaMax - lumaMin, 1e-4) * 0.5, 0.0, 1.0);
+    edge *= edge;
+
+    vec2 direction = length(gradient) > 1e-5 ? normalize(gradient) : vec2(1.0, 0.0);
+
+    // on an edge the kernel is stretched along it and squeezed across it, diagonals are stretched the most
+    float stretch = 1.0 / max(abs(direction.x), abs(direction.y));
+    vec2 scale = vec2(1.0 + (stretch - 1.0) * edge, 1.0 - 0.5 * edge);
+    float lobe = 0.5 + ((1.0 / 4.0 - 0.04) - 0.5) * edge;
+
+    vec3 color = vec3(0.0);
+    float totalWeight = 0.0;
+
+    vec3 taps[12] = vec3[](b, c, e, f, g, h, i, j, k, l, n, o);
+    vec2 offsets[12] = vec2[](vec2(0, -1), vec2(1, -1), vec2(-1, 0), vec2(0, 0), vec2(1, 0), vec2(2, 0),
+                              vec2(-1, 1), vec2(0, 1), vec2(1, 1), vec2(2, 1), vec2(0, 2), vec2(1, 2));
+
+    for (int t = 0; t < 12; t++) {
+        vec2 offset = offsets[t] - fraction;
+        // offset in the frame of the edge: x along the gradient (across the edge), y along the edge
+        vec2 rotated = vec2(dot(offset, direction), dot(offset, vec2(-direction.y, direction.x))) * scale;
+        float weight = lanczos2(dot(rotated, rotated), lobe);
+
+        color += taps[t] * weight;
+        totalWeight += weight;
+    }
+
+    color /= totalWeight;
+
+    // the negative lobes can overshoot, keep the result inside the range of the nearest texels
+    vec3 minColor = min(min(f, g), min(j, k));
+    vec3 maxColor = max(max(f, g), max(j, k));
+
+    FragColor = vec4(clamp(color, minColor, maxColor), 1.0);
+}
@@ -1,7 +0,0 @@
-#version 440 compatibility
-
-out vec3 finalColor;
-
-void main() {
-  finalColor = vec3(1.0, 1.0, 1.0);
-}
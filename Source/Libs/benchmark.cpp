@@ -0,0 +1,219 @@
+#include "benchmark.h"
+#include <glad\glad.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include "init.h"
+
+// constructor method
+Benchmark::Benchmark(int argc, char** argv) {
+	this->frames = BENCHMARK_FRAMES;
+	this->reportPath = BENCHMARK_REPORT_PATH;
+
+	for (int i = 1; i < argc; i++) {
+		bool value = i + 1 < argc;
+
+		if (strcmp(argv[i], "--headless") == 0) {
+			headless = true;
+		}
+		else if (strcmp(argv[i], "--frames") == 0 && value) {
+			this->frames = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--stress") == 0 && value) {
+			stressEntities = std::max(atoi(argv[++i]), 0);
+		}
+		else if (strcmp(argv[i], "--path") == 0 && value) {
+			this->pathFile = argv[++i];
+		}
+		else if (strcmp(argv[i], "--report") == 0 && value) {
+			this->reportPath = argv[++i];
+		}
+		else {
+			printf("benchmark: unknown argument %s\n", argv[i]);
+		}
+	}
+
+	// the frames after the measured ones wait for the GPU times, all of them have to stay in the ring
+	this->frames = std::min(std::max(this->frames, 1), FRAME_STATS_FRAMES - 2 * GPU_TIMER_FRAMES);
+
+	if (this->pathFile.empty() || !this->loadPath(this->pathFile)) {
+		this->pathFile.clear();
+		this->createOrbit();
+	}
+}
+
+int Benchmark::run(GLFWwindow* window, Renderer* renderer) {
+	FrameStats* frameStats = renderer->getFrameStats();
+
+	// the frames are timed, not presented
+	glfwSwapInterval(0);
+	profiler->setThreadName("main");
+	this->placeCamera(0.0f);
+
+	// the programs are compiled in the background, the first frames draw without some of them
+	int ready = 0;
+
+	for (int i = 0; i < BENCHMARK_MAX_SHADER_FRAMES && ready < BENCHMARK_WARMUP_FRAMES && !glfwWindowShouldClose(window); i++) {
+		bool compiled = true;
+
+		for (int j = 0; j < shaderBuffer.size(); j++) {
+			compiled = compiled && shaderBuffer[j].isReady();
+		}
+
+		if (compiled) {
+			ready++;
+		}
+
+		this->drawFrame(window, renderer);
+	}
+
+	printf("benchmark: %d frames through %d camera keys, %d entities\n", this->frames, (int)this->path.size(), (int)entityBuffer.size());
+
+	int first = frameStats->getFrameCount();
+
+	for (int i = 0; i < this->frames && !glfwWindowShouldClose(window); i++) {
+		this->placeCamera(this->frames > 1 ? (float)i / (float)(this->frames - 1) : 0.0f);
+		this->drawFrame(window, renderer);
+	}
+
+	int measured = frameStats->getFrameCount() - first;
+
+	// the GPU times of the last frames are filled in by the frames after them
+	for (int i = 0; i < 2 * GPU_TIMER_FRAMES; i++) {
+		this->drawFrame(window, renderer);
+	}
+
+	std::vector<frameSample_t> samples = frameStats->getSamples(frameStats->getFrameCount() - first);
+	samples.resize(std::min((int)samples.size(), measured));
+
+	bool written = this->writeReport(frameStats, samples);
+
+	std::vector<double> frameTimes;
+
+	for (int i = 0; i < samples.size(); i++) {
+		frameTimes.push_back(samples[i].frameTime);
+	}
+
+	frameSummary_t summary = FrameStats::summarize(frameTimes);
+	printf("benchmark: frame time p50 %.2f ms, p95 %.2f ms, p99 %.2f ms, max %.2f ms\n", summary.p50 * 1000.0, summary.p95 * 1000.0, summary.p99 * 1000.0, summary.max * 1000.0);
+
+	glfwDestroyWindow(window);
+	glfwTerminate();
+
+	return(written && measured == this->frames ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+bool Benchmark::loadPath(std::string file) {
+	std::ifstream input(file);
+
+	if (!input) {
+		printf("benchmark: can't read the camera path %s, orbiting the scene\n", file.c_str());
+		return(false);
+	}
+
+	std::string line;
+
+	while (std::getline(input, line)) {
+		std::istringstream stream(line);
+		cameraKey_t key;
+
+		if (line.empty() || line[0] == '#') {
+			continue;
+		}
+
+		if (stream >> key.position.x >> key.position.y >> key.position.z >> key.target.x >> key.target.y >> key.target.z) {
+			this->path.push_back(key);
+		}
+		else {
+			printf("benchmark: skipping the camera key \"%s\"\n", line.c_str());
+		}
+	}
+
+	if (this->path.empty()) {
+		printf("benchmark: no camera keys in %s, orbiting the scene\n", file.c_str());
+		return(false);
+	}
+
+	return(true);
+}
+
+// the last key is the first one again, so the path can be replayed without a jump
+void Benchmark::createOrbit() {
+	this->path.clear();
+
+	for (int i = 0; i <= 8; i++) {
+		float angle = glm::radians(45.0f * i);
+		cameraKey_t key;
+
+		key.position = glm::vec3(cos(angle) * 40.0f, 15.0f, sin(angle) * 40.0f);
+		key.target = glm::vec3(0.0f);
+
+		this->path.push_back(key);
+	}
+}
+
+// linear between the keys, the orientation is the yaw and pitch (degrees) of the direction to the target
+void Benchmark::placeCamera(float t) {
+	float position = glm::clamp(t, 0.0f, 1.0f) * (this->path.size() - 1);
+	int key = std::min((int)position, (int)this->path.size() - 1);
+	int next = std::min(key + 1, (int)this->path.size() - 1);
+	float blend = position - key;
+
+	glm::vec3 eye = glm::mix(this->path[key].position, this->path[next].position, blend);
+	glm::vec3 target = glm::mix(this->path[key].target, this->path[next].target, blend);
+	glm::vec3 direction = target - eye;
+
+	if (glm::length(direction) < 0.0001f) {
+		direction = glm::vec3(1.0f, 0.0f, 0.0f);
+	}
+
+	direction = glm::normalize(direction);
+
+	camera.setPosition(eye);
+	camera.setOrientation(glm::vec3(camera.getOrientation().x, glm::degrees(atan2(direction.z, direction.x)), glm::degrees(asin(direction.y))));
+}
+
+void Benchmark::drawFrame(GLFWwindow* window, Renderer* renderer) {
+	{
+		PROFILE_ZONE("frame");
+
+		renderer->render();
+		glfwPollEvents();
+		glfwSwapBuffers(window);
+	}
+
+	profiler->endFrame();
+}
+
+bool Benchmark::writeReport(FrameStats* frameStats, std::vector<frameSample_t> samples) {
+	std::ofstream file(this->reportPath);
+
+	if (!file) {
+		printf("benchmark: can't write %s\n", this->reportPath.c_str());
+		return(false);
+	}
+
+	file << "{\n\"renderer\":\"" << Profiler::escapeJSON((const char*)glGetString(GL_RENDERER)) << "\",\n";
+	file << "\"version\":\"" << Profiler::escapeJSON((const char*)glGetString(GL_VERSION)) << "\",\n";
+	file << "\"width\":" << screenWidth << ",\n\"height\":" << screenHeight << ",\n";
+	file << "\"entities\":" << entityBuffer.size() << ",\n\"stressEntities\":" << stressEntities << ",\n";
+	file << "\"cameraPath\":\"" << (this->pathFile.empty() ? "orbit" : Profiler::escapeJSON(this->pathFile)) << "\",\n";
+	file << "\"stats\":";
+	frameStats->writeJSON(file, samples);
+	file << "}\n";
+	file.close();
+
+	// a full disk only shows once the stream is flushed
+	if (file.fail()) {
+		printf("benchmark: can't write %s\n", this->reportPath.c_str());
+		return(false);
+	}
+
+	printf("benchmark: report written to %s\n", this->reportPath.c_str());
+
+	return(true);
+}
@@ -0,0 +1,57 @@
+#ifndef __BENCHMARK__
+#define __BENCHMARK__
+
+#include <string>
+#include <vector>
+#include <glm\glm.hpp>
+#include "GLFW\glfw3.h"
+#include "renderer.h"
+
+// frames measured when the command line doesn't say, they have to fit in the ring of the frame statistics
+#define BENCHMARK_FRAMES 600
+// frames drawn once every shader is compiled and before the measurement, so caches and the TAA history settle
+#define BENCHMARK_WARMUP_FRAMES 60
+// frames the warm up waits at most for the shaders, a shader that fails to compile is ready but never usable
+#define BENCHMARK_MAX_SHADER_FRAMES 3000
+#define BENCHMARK_REPORT_PATH "../benchmark.json"
+
+// point the camera passes through, looking at the target
+typedef struct {
+	glm::vec3 position;
+	glm::vec3 target;
+} cameraKey_t;
+
+// class replaying a camera path through the scene for a fixed number of frames, without events or interface, and
+// writing the frame and pass times as a JSON report. Command line:
+// --headless             draw offscreen and run the benchmark instead of the interactive loop
+// --frames <n>           frames measured
+// --stress <n>           copies of a model added to the scene
+// --path <file>          camera path, one "x y z targetX targetY targetZ" key per line, an orbit around the scene otherwise
+// --report <file>        where the report is written
+class Benchmark {
+	public:
+		// constructor method, reads the command line (argc, argv) and sets headless and stressEntities before setup()
+		Benchmark(int, char**);
+
+		// method for warming up, measuring and writing the report (window, renderer), returns the exit code
+		int run(GLFWwindow*, Renderer*);
+
+	private:
+		int frames;
+		std::string pathFile;
+		std::string reportPath;
+		std::vector<cameraKey_t> path;
+
+		// method for reading the camera path, false if the file can't be read
+		bool loadPath(std::string);
+		// method for a closed orbit around the scene
+		void createOrbit();
+		// method for placing the camera along the path (0 at the first key, 1 at the last)
+		void placeCamera(float);
+		// method for drawing and presenting a frame (window, renderer)
+		void drawFrame(GLFWwindow*, Renderer*);
+		// method for writing the report (frame statistics, measured samples), false if it couldn't be written
+		bool writeReport(FrameStats*, std::vector<frameSample_t>);
+};
+
+#endif
@@ -0,0 +1,247 @@
+#include "debugDraw.h"
+#include <glad\glad.h>
+#include <math.h>
+#include "init.h"
+
+// constructor method, creates the ring buffer, the unit sphere and the shaders
+DebugDraw::DebugDraw() {
+	this->frame = 0;
+	this->vertexCount = 0;
+	this->sphereCount = 0;
+	this->drawCalls = 0;
+	this->mapped = NULL;
+
+	for (int i = 0; i < DEBUG_DRAW_FRAMES; i++) {
+		this->fences[i] = NULL;
+	}
+
+	// persistent mapping: the buffer stays mapped for its whole life and the CPU writes straight into it, the fences
+	// make sure a part of the ring isn't overwritten while the GPU still reads it
+	this->persistent = GLAD_GL_VERSION_4_4 != 0;
+
+	if (this->persistent) {
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		this->ringBuffer = glState->createBuffer(DEBUG_DRAW_FRAMES * this->getFrameSize(), NULL, flags);
+		this->mapped = (float*)glState->mapBuffer(this->ringBuffer, DEBUG_DRAW_FRAMES * this->getFrameSize(), flags);
+	}
+	else {
+		this->ringBuffer = glState->createBuffer(DEBUG_DRAW_FRAMES * this->getFrameSize(), NULL, GL_DYNAMIC_STORAGE_BIT);
+		this->staging.resize(this->getFrameSize() / sizeof(float));
+	}
+
+	// unit sphere shared by all the spheres: a circle around each axis, as pairs of line vertices
+	std::vector<float> unitSphere;
+	double pi = 3.1415926535897;
+
+	for (int axis = 0; axis < 3; axis++) {
+		for (int i = 0; i < DEBUG_DRAW_SPHERE_SIDES; i++) {
+			for (int j = 0; j < 2; j++) {
+				float angle = (float)(2.0 * pi * (i + j) / DEBUG_DRAW_SPHERE_SIDES);
+				glm::vec3 point;
+
+				if (axis == 0) {
+					point = glm::vec3(cos(angle), sin(angle), 0.0f);
+				}
+				else if (axis == 1) {
+					point = glm::vec3(0.0f, sin(angle), cos(angle));
+				}
+				else {
+					point = glm::vec3(sin(angle), 0.0f, cos(angle));
+				}
+
+				unitSphere.push_back(point.x);
+				unitSphere.push_back(point.y);
+				unitSphere.push_back(point.z);
+			}
+		}
+	}
+
+	this->sphereVertices = unitSphere.size() / 3;
+
+	this->sphereBuffer = glState->createBuffer(unitSphere.size() * sizeof(float), &unitSphere[0], 0);
+
+	this->lineShader = new Shader((char*)"debug line shader");
+	this->lineShader->loadShader((char*)"../Shader/debug/line.vert", (char*)"../Shader/debug/line.frag");
+	this->sphereShader = new Shader((char*)"debug sphere shader");
+	this->sphereShader->loadShader((char*)"../Shader/debug/sphere.vert", (char*)"../Shader/debug/line.frag");
+
+	this->begin();
+}
+
+void DebugDraw::begin() {
+	this->frame = (this->frame + 1) % DEBUG_DRAW_FRAMES;
+	this->vertexCount = 0;
+	this->sphereCount = 0;
+
+	float* base;
+
+	if (this->persistent) {
+		// the last draw from this part of the ring was DEBUG_DRAW_FRAMES frames ago, it's normally done already
+		if (this->fences[this->frame] != NULL) {
+			glClientWaitSync(this->fences[this->frame], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+			glDeleteSync(this->fences[this->frame]);
+			this->fences[this->frame] = NULL;
+		}
+
+		base = this->mapped + this->getFrameOffset() / sizeof(float);
+	}
+	else {
+		base = &this->staging[0];
+	}
+
+	this->vertices = base;
+	this->spheres = base + DEBUG_DRAW_MAX_VERTICES * DEBUG_DRAW_VERTEX_FLOATS;
+}
+
+void DebugDraw::line(glm::vec3 start, glm::vec3 end, glm::vec3 color) {
+	if (this->vertexCount + 2 > DEBUG_DRAW_MAX_VERTICES) {
+		return;
+	}
+
+	float* vertex = this->vertices + this->vertexCount * DEBUG_DRAW_VERTEX_FLOATS;
+
+	vertex[0] = start.x;
+	vertex[1] = start.y;
+	vertex[2] = start.z;
+	vertex[3] = color.x;
+	vertex[4] = color.y;
+	vertex[5] = color.z;
+	vertex[6] = end.x;
+	vertex[7] = end.y;
+	vertex[8] = end.z;
+	vertex[9] = color.x;
+	vertex[10] = color.y;
+	vertex[11] = color.z;
+
+	this->vertexCount += 2;
+}
+
+void DebugDraw::box(bounds_t bounds, glm::vec3 color) {
+	// a b c d and e f g h are the two opposite faces, with a-f, b-g, c-h and d-e joining them
+	this->line(bounds.a, bounds.b, color);
+	this->line(bounds.b, bounds.c, color);
+	this->line(bounds.c, bounds.d, color);
+	this->line(bounds.d, bounds.a, color);
+	this->line(bounds.a, bounds.f, color);
+	this->line(bounds.b, bounds.g, color);
+	this->line(bounds.c, bounds.h, color);
+	this->line(bounds.d, bounds.e, color);
+	this->line(bounds.f, bounds.e, color);
+	this->line(bounds.e, bounds.h, color);
+	this->line(bounds.h, bounds.g, color);
+	this->line(bounds.g, bounds.f, color);
+}
+
+void DebugDraw::sphere(glm::vec3 center, float radius, glm::vec3 color) {
+	if (this->sphereCount >= DEBUG_DRAW_MAX_SPHERES) {
+		return;
+	}
+
+	float* instance = this->spheres + this->sphereCount * DEBUG_DRAW_SPHERE_FLOATS;
+
+	instance[0] = center.x;
+	instance[1] = center.y;
+	instance[2] = center.z;
+	instance[3] = radius;
+	instance[4] = color.x;
+	instance[5] = color.y;
+	instance[6] = color.z;
+
+	this->sphereCount++;
+}
+
+void DebugDraw::flush(glm::mat4 viewMatrix, glm::mat4 projectionMatrix) {
+	this->drawCalls = 0;
+
+	if (this->vertexCount == 0 && this->sphereCount == 0) {
+		return;
+	}
+
+	glm::mat4 viewProjection = projectionMatrix * viewMatrix;
+	size_t offset = this->getFrameOffset();
+	size_t sphereOffset = offset + DEBUG_DRAW_MAX_VERTICES * DEBUG_DRAW_VERTEX_FLOATS * sizeof(float);
+
+	if (!this->persistent) {
+		glState->bufferSubData(this->ringBuffer, offset, this->vertexCount * DEBUG_DRAW_VERTEX_FLOATS * sizeof(float), this->vertices);
+		glState->bufferSubData(this->ringBuffer, sphereOffset, this->sphereCount * DEBUG_DRAW_SPHERE_FLOATS * sizeof(float), this->spheres);
+	}
+
+	glState->bindBuffer(GL_ARRAY_BUFFER, this->ringBuffer);
+
+	// the lines don't take part in the outline, so the stencil ids of the entities are left alone
+	glState->stencilMask(0x00);
+
+	if (this->vertexCount > 0) {
+		glState->useProgram(this->lineShader->getID());
+		glState->uniformMatrix4fv(glState->getUniformLocation(this->lineShader->getID(), "viewProjection"), 1, GL_FALSE, &(viewProjection[0][0]));
+
+		glEnableVertexAttribArray(0);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, DEBUG_DRAW_VERTEX_FLOATS * sizeof(float), (void*)offset);
+		glEnableVertexAttribArray(1);
+		glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, DEBUG_DRAW_VERTEX_FLOATS * sizeof(float), (void*)(offset + 3 * sizeof(float)));
+
+		glDrawArrays(GL_LINES, 0, this->vertexCount);
+		this->drawCalls++;
+
+		glDisableVertexAttribArray(0);
+		glDisableVertexAttribArray(1);
+	}
+
+	if (this->sphereCount > 0) {
+		glState->useProgram(this->sphereShader->getID());
+		glState->uniformMatrix4fv(glState->getUniformLocation(this->sphereShader->getID(), "viewProjection"), 1, GL_FALSE, &(viewProjection[0][0]));
+
+		// the unit sphere per vertex, center, radius and color per instance
+		glState->bindBuffer(GL_ARRAY_BUFFER, this->sphereBuffer);
+		glEnableVertexAttribArray(0);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+		glState->bindBuffer(GL_ARRAY_BUFFER, this->ringBuffer);
+		glEnableVertexAttribArray(1);
+		glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, DEBUG_DRAW_SPHERE_FLOATS * sizeof(float), (void*)sphereOffset);
+		glVertexAttribDivisor(1, 1);
+		glEnableVertexAttribArray(2);
+		glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, DEBUG_DRAW_SPHERE_FLOATS * sizeof(float), (void*)(sphereOffset + 4 * sizeof(float)));
+		glVertexAttribDivisor(2, 1);
+
+		glDrawArraysInstanced(GL_LINES, 0, this->sphereVertices, this->sphereCount);
+		this->drawCalls++;
+
+		glVertexAttribDivisor(1, 0);
+		glVertexAttribDivisor(2, 0);
+		glDisableVertexAttribArray(0);
+		glDisableVertexAttribArray(1);
+		glDisableVertexAttribArray(2);
+	}
+
+	glState->stencilMask(0xFF);
+
+	if (this->persistent) {
+		this->fences[this->frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+}
+
+bool DebugDraw::isPersistent() {
+	return(this->persistent);
+}
+
+int DebugDraw::getVertexCount() {
+	return(this->vertexCount);
+}
+
+int DebugDraw::getSphereCount() {
+	return(this->sphereCount);
+}
+
+int DebugDraw::getDrawCalls() {
+	return(this->drawCalls);
+}
+
+// bytes of the ring used by a frame: the line vertices followed by the sphere instances
+size_t DebugDraw::getFrameSize() {
+	return((DEBUG_DRAW_MAX_VERTICES * DEBUG_DRAW_VERTEX_FLOATS + DEBUG_DRAW_MAX_SPHERES * DEBUG_DRAW_SPHERE_FLOATS) * sizeof(float));
+}
+
+size_t DebugDraw::getFrameOffset() {
+	return(this->frame * this->getFrameSize());
+}
@@ -0,0 +1,73 @@
+#ifndef __DEBUGDRAW__
+#define __DEBUGDRAW__
+
+#include <vector>
+#include <glm\glm.hpp>
+#include "entity.h"
+#include "shader.h"
+
+// frames the ring buffer is split into, the GPU can still be reading the last two while the next one is written
+#define DEBUG_DRAW_FRAMES 3
+// most line vertices and spheres a frame can hold, the ones after are dropped
+#define DEBUG_DRAW_MAX_VERTICES 65536
+#define DEBUG_DRAW_MAX_SPHERES 4096
+// segments of every circle of the unit sphere
+#define DEBUG_DRAW_SPHERE_SIDES 64
+
+// floats of a line vertex (position, color) and of a sphere instance (center, radius, color)
+#define DEBUG_DRAW_VERTEX_FLOATS 6
+#define DEBUG_DRAW_SPHERE_FLOATS 7
+
+// class for drawing lines and wireframe spheres for debugging: everything added during the frame is written to a
+// persistently mapped ring buffer and drawn by flush with one draw for the lines and one instanced draw of a shared
+// unit sphere for the spheres
+class DebugDraw {
+	public:
+		// constructor method
+		DebugDraw();
+
+		// method for starting a new frame, waits for the GPU to be done with the part of the ring that's reused
+		void begin();
+		// method for adding a line (start, end, color)
+		void line(glm::vec3, glm::vec3, glm::vec3);
+		// method for adding the 12 edges of a box (corners, color)
+		void box(bounds_t, glm::vec3);
+		// method for adding a sphere made of 3 circles (center, radius, color)
+		void sphere(glm::vec3, float, glm::vec3);
+		// method for drawing everything added since begin (view matrix, projection matrix)
+		void flush(glm::mat4, glm::mat4);
+
+		// checks if the ring buffer is persistently mapped (openGL 4.4), otherwise it's uploaded at every flush
+		bool isPersistent();
+		int getVertexCount();
+		int getSphereCount();
+		int getDrawCalls();
+
+	private:
+		unsigned int ringBuffer;
+		unsigned int sphereBuffer;
+		int sphereVertices;
+
+		bool persistent;
+		// whole ring when it's persistently mapped, otherwise a copy of a single frame
+		float* mapped;
+		std::vector<float> staging;
+		// fences of the frames drawn from each part of the ring
+		GLsync fences[DEBUG_DRAW_FRAMES];
+		int frame;
+
+		// where the lines and spheres of the current frame are written
+		float* vertices;
+		float* spheres;
+		int vertexCount;
+		int sphereCount;
+		int drawCalls;
+
+		Shader* lineShader;
+		Shader* sphereShader;
+
+		size_t getFrameSize();
+		size_t getFrameOffset();
+};
+
+#endif
@@ -0,0 +1,208 @@
+#include "drawProfiler.h"
+#include <glad\glad.h>
+#include <stdio.h>
+#include "init.h"
+
+// constructor method
+DrawProfiler::DrawProfiler() {
+	this->statistics = GLAD_GL_VERSION_4_6 || glfwExtensionSupported("GL_ARB_pipeline_statistics_query");
+
+	for (int i = 0; i < DRAW_PROFILER_FRAMES; i++) {
+		glGenQueries(DRAW_PROFILER_QUERIES * DRAW_PROFILER_DRAWS * drawPassCount, this->frames[i].queries);
+
+		for (int j = 0; j < drawPassCount; j++) {
+			this->frames[i].counts[j] = 0;
+		}
+
+		this->frames[i].last = -1;
+		this->frames[i].skipped = 0;
+		this->frames[i].issued = false;
+	}
+
+	this->current = 0;
+	this->open = -1;
+	this->droppedFrames = 0;
+	this->unmeasuredDraws = 0;
+
+	if (!this->statistics) {
+		printf("draw profiler: no pipeline statistics queries, only the draw times are measured\n");
+	}
+}
+
+void DrawProfiler::beginFrame() {
+	drawProfilerFrame_t* frame = &this->frames[this->current];
+
+	if (frame->issued) {
+		this->unmeasuredDraws = frame->skipped;
+	}
+
+	if (frame->issued && frame->last >= 0) {
+		// the end timestamp of the last draw is the last query to finish
+		int available = 0;
+		glGetQueryObjectiv(frame->queries[DRAW_PROFILER_QUERIES * frame->last + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+		if (available) {
+			this->readFrame(frame);
+		}
+		else {
+			this->droppedFrames++;
+		}
+	}
+
+	for (int i = 0; i < drawPassCount; i++) {
+		frame->counts[i] = 0;
+	}
+
+	frame->last = -1;
+	frame->skipped = 0;
+	frame->issued = false;
+}
+
+void DrawProfiler::begin(int entity, int shader, drawPass_t pass) {
+	drawProfilerFrame_t* frame = &this->frames[this->current];
+
+	if (this->open >= 0) {
+		return;
+	}
+
+	if (frame->counts[pass] >= DRAW_PROFILER_DRAWS) {
+		frame->skipped++;
+		return;
+	}
+
+	int slot = DRAW_PROFILER_DRAWS * pass + frame->counts[pass];
+	unsigned int* queries = &frame->queries[DRAW_PROFILER_QUERIES * slot];
+
+	frame->entities[slot] = entity;
+	frame->shaders[slot] = shader;
+
+	glQueryCounter(queries[0], GL_TIMESTAMP);
+
+	if (this->statistics) {
+		glBeginQuery(GL_VERTICES_SUBMITTED, queries[2]);
+		glBeginQuery(GL_PRIMITIVES_SUBMITTED, queries[3]);
+		glBeginQuery(GL_FRAGMENT_SHADER_INVOCATIONS, queries[4]);
+	}
+
+	frame->counts[pass]++;
+	this->open = slot;
+}
+
+void DrawProfiler::end() {
+	if (this->open < 0) {
+		return;
+	}
+
+	drawProfilerFrame_t* frame = &this->frames[this->current];
+	unsigned int* queries = &frame->queries[DRAW_PROFILER_QUERIES * this->open];
+
+	if (this->statistics) {
+		glEndQuery(GL_VERTICES_SUBMITTED);
+		glEndQuery(GL_PRIMITIVES_SUBMITTED);
+		glEndQuery(GL_FRAGMENT_SHADER_INVOCATIONS);
+	}
+
+	glQueryCounter(queries[1], GL_TIMESTAMP);
+
+	frame->last = this->open;
+	this->open = -1;
+}
+
+void DrawProfiler::endFrame() {
+	this->frames[this->current].issued = true;
+	this->current = (this->current + 1) % DRAW_PROFILER_FRAMES;
+}
+
+std::vector<drawCost_t> DrawProfiler::getEntityCosts() {
+	return(this->entityCosts);
+}
+
+std::vector<drawCost_t> DrawProfiler::getShaderCosts() {
+	return(this->shaderCosts);
+}
+
+bool DrawProfiler::hasStatistics() {
+	return(this->statistics);
+}
+
+int DrawProfiler::getDroppedFrames() {
+	return(this->droppedFrames);
+}
+
+int DrawProfiler::getUnmeasuredDraws() {
+	return(this->unmeasuredDraws);
+}
+
+void DrawProfiler::readFrame(drawProfilerFrame_t* frame) {
+	std::vector<drawCost_t> entityCosts;
+	std::vector<drawCost_t> shaderCosts;
+
+	for (int i = 0; i < DRAW_PROFILER_DRAWS * drawPassCount; i++) {
+		// the draws of a pass fill the start of its range
+		if (i % DRAW_PROFILER_DRAWS >= frame->counts[i / DRAW_PROFILER_DRAWS]) {
+			continue;
+		}
+
+		unsigned int* queries = &frame->queries[DRAW_PROFILER_QUERIES * i];
+		GLuint64 results[DRAW_PROFILER_QUERIES] = {};
+
+		for (int j = 0; j < DRAW_PROFILER_QUERIES; j++) {
+			if (j < 2 || this->statistics) {
+				glGetQueryObjectui64v(queries[j], GL_QUERY_RESULT, &results[j]);
+			}
+		}
+
+		drawCost_t cost;
+		cost.gpuTime = (results[1] - results[0]) / 1000000000.0;
+		cost.vertices = (double)results[2];
+		cost.primitives = (double)results[3];
+		cost.fragments = (double)results[4];
+		cost.draws = 1;
+
+		// the entities and shaders could have been removed since the frame was drawn
+		if (frame->entities[i] < entityBuffer.size()) {
+			cost.name = entityBuffer[frame->entities[i]]->getName();
+			addCost(&entityCosts, cost);
+		}
+
+		if (frame->shaders[i] < shaderBuffer.size()) {
+			cost.name = shaderBuffer[frame->shaders[i]].getName();
+			addCost(&shaderCosts, cost);
+		}
+	}
+
+	this->entityCosts = average(this->entityCosts, entityCosts);
+	this->shaderCosts = average(this->shaderCosts, shaderCosts);
+}
+
+void DrawProfiler::addCost(std::vector<drawCost_t>* costs, drawCost_t cost) {
+	for (int i = 0; i < costs->size(); i++) {
+		if ((*costs)[i].name == cost.name) {
+			(*costs)[i].gpuTime += cost.gpuTime;
+			(*costs)[i].vertices += cost.vertices;
+			(*costs)[i].primitives += cost.primitives;
+			(*costs)[i].fragments += cost.fragments;
+			(*costs)[i].draws += cost.draws;
+			return;
+		}
+	}
+
+	costs->push_back(cost);
+}
+
+// the costs that weren't drawn in the new frame are dropped, the new ones start from their first measurement
+std::vector<drawCost_t> DrawProfiler::average(std::vector<drawCost_t> previous, std::vector<drawCost_t> costs) {
+	for (int i = 0; i < costs.size(); i++) {
+		for (int j = 0; j < previous.size(); j++) {
+			if (previous[j].name == costs[i].name) {
+				costs[i].gpuTime = previous[j].gpuTime + (costs[i].gpuTime - previous[j].gpuTime) * 0.1;
+				costs[i].vertices = previous[j].vertices + (costs[i].vertices - previous[j].vertices) * 0.1;
+				costs[i].primitives = previous[j].primitives + (costs[i].primitives - previous[j].primitives) * 0.1;
+				costs[i].fragments = previous[j].fragments + (costs[i].fragments - previous[j].fragments) * 0.1;
+				break;
+			}
+		}
+	}
+
+	return(costs);
+}
@@ -0,0 +1,90 @@
+#ifndef __DRAWPROFILER__
+#define __DRAWPROFILER__
+
+#include <string>
+#include <vector>
+
+// frames in flight, the results of a frame are read when its slot is reused
+#define DRAW_PROFILER_FRAMES 4
+// draws measured per pass and frame, the draws past it are counted as not measured
+#define DRAW_PROFILER_DRAWS 256
+// queries of a draw: start and end timestamps, then vertices, primitives and fragment shader invocations
+#define DRAW_PROFILER_QUERIES 5
+
+// passes the draws are measured in, each with its own budget since the reflection cubemap draws every entity once
+// per face and would use up the one of the forward pass
+typedef enum {
+	forwardDrawPass,
+	reflectionDrawPass,
+	drawPassCount
+} drawPass_t;
+
+// averaged cost of the draws of an entity or a shader per frame
+typedef struct {
+	std::string name;
+	// GPU time (s)
+	double gpuTime;
+	double vertices;
+	double primitives;
+	double fragments;
+	int draws;
+} drawCost_t;
+
+// queries of the draws of one frame, with the entity and shader of each draw. Every pass has its own range of
+// DRAW_PROFILER_DRAWS draws
+typedef struct {
+	unsigned int queries[DRAW_PROFILER_QUERIES * DRAW_PROFILER_DRAWS * drawPassCount];
+	int entities[DRAW_PROFILER_DRAWS * drawPassCount];
+	int shaders[DRAW_PROFILER_DRAWS * drawPassCount];
+	int counts[drawPassCount];
+	// draw whose end timestamp was queried last, and the draws that didn't fit in the budget of their pass
+	int last;
+	int skipped;
+	bool issued;
+} drawProfilerFrame_t;
+
+// class measuring every entity draw with timestamps and pipeline statistics queries (ARB_pipeline_statistics_query,
+// core in openGL 4.6), summed per entity and per shader. The queries go through a ring of frames like the pass timer,
+// so reading them never waits for the GPU
+class DrawProfiler {
+	public:
+		// constructor method, creates the queries and checks for pipeline statistics
+		DrawProfiler();
+
+		// method for reading the results of the frame that used this slot and starting a new one
+		void beginFrame();
+		// methods for measuring a draw (entity index, shader index, pass), draws don't nest
+		void begin(int, int, drawPass_t);
+		void end();
+		// method for moving to the next slot of the ring
+		void endFrame();
+
+		// averaged cost of the draws of every entity and every shader in the last frame that was read
+		std::vector<drawCost_t> getEntityCosts();
+		std::vector<drawCost_t> getShaderCosts();
+		// the driver counts vertices, primitives and fragments, otherwise only the times are measured
+		bool hasStatistics();
+		int getDroppedFrames();
+		// draws of the last frame that was read past the budget of their pass
+		int getUnmeasuredDraws();
+
+	private:
+		drawProfilerFrame_t frames[DRAW_PROFILER_FRAMES];
+		int current;
+		bool statistics;
+		// slot of the draw being measured, -1 between draws
+		int open;
+		std::vector<drawCost_t> entityCosts;
+		std::vector<drawCost_t> shaderCosts;
+		int droppedFrames;
+		int unmeasuredDraws;
+
+		// method for summing the draws of a frame per entity and per shader
+		void readFrame(drawProfilerFrame_t*);
+		// method for adding a draw to the cost with the same name, or a new one
+		static void addCost(std::vector<drawCost_t>*, drawCost_t);
+		// method for averaging the costs of a frame with the previous ones
+		static std::vector<drawCost_t> average(std::vector<drawCost_t>, std::vector<drawCost_t>);
+};
+
+#endif
@@ -0,0 +1,435 @@
+#include "frameStats.h"
+#include "profiler.h"
+#include "GLFW\glfw3.h"
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <functional>
+#include <fstream>
+
+// constructor method
+FrameStats::FrameStats() {
+	this->samples.resize(FRAME_STATS_FRAMES);
+
+	for (int i = 0; i < this->samples.size(); i++) {
+		this->samples[i].frame = -1;
+	}
+
+	this->currentFrame = -1;
+	this->gpuFrame = -1;
+	this->lastTime = -1.0;
+	this->median = 0.0;
+	this->hitchCount = 0;
+	this->captureStart = 0;
+	this->captureCount = 0;
+}
+
+void FrameStats::record(double cpuTime, GPUTimer* timer) {
+	double time = glfwGetTime();
+
+	this->currentFrame = timer->getFrameCount() - 1;
+
+	frameSample_t* sample = &this->samples[this->currentFrame % FRAME_STATS_FRAMES];
+	sample->frame = this->currentFrame;
+	sample->time = time;
+	sample->frameTime = this->lastTime < 0.0 ? 0.0 : time - this->lastTime;
+	sample->cpuTime = cpuTime;
+	sample->gpuTime = -1.0;
+	sample->hitch = false;
+
+	for (int i = 0; i < FRAME_STATS_PASSES; i++) {
+		sample->passGPUTimes[i] = -1.0f;
+		sample->passCPUTimes[i] = -1.0f;
+	}
+
+	this->lastTime = time;
+
+	// a frame much longer than the ones before it, the median is only updated every few frames so a long hitch doesn't
+	// raise it right away
+	if (this->median > 0.0 && sample->frameTime > this->median * FRAME_STATS_HITCH_FACTOR &&
+		sample->frameTime - this->median > FRAME_STATS_HITCH_MIN) {
+		hitch_t hitch;
+		hitch.frame = sample->frame;
+		hitch.frameTime = sample->frameTime;
+		hitch.median = this->median;
+
+		sample->hitch = true;
+		this->hitches.insert(this->hitches.begin(), hitch);
+		this->hitchCount++;
+
+		if (this->hitches.size() > FRAME_STATS_HITCH_HISTORY) {
+			this->hitches.pop_back();
+		}
+	}
+
+	if (this->currentFrame % FRAME_STATS_MEDIAN_INTERVAL == 0) {
+		this->updateMedian();
+	}
+
+	// the GPU times of a frame drawn a few frames ago
+	int gpuFrame = timer->getLastFrame();
+
+	if (gpuFrame >= 0 && gpuFrame != this->gpuFrame) {
+		frameSample_t* gpuSample = this->getSample(gpuFrame);
+		std::vector<gpuTiming_t> timings = timer->getLastTimings();
+
+		if (gpuSample != NULL) {
+			gpuSample->gpuTime = timer->getLastFrameTime();
+
+			// the sections nested in a pass are part of its time, only the passes get a column
+			for (int i = 0; i < timings.size(); i++) {
+				if (timings[i].depth > 0) {
+					continue;
+				}
+
+				int column = this->getPassColumn(timings[i].name);
+
+				if (column >= 0) {
+					gpuSample->passGPUTimes[column] = (float)timings[i].gpuTime;
+					gpuSample->passCPUTimes[column] = (float)timings[i].cpuTime;
+				}
+			}
+		}
+
+		this->gpuFrame = gpuFrame;
+	}
+
+	// a capture is written once the GPU times of its last frame are in, or once they can't come anymore
+	if (this->captureCount > 0) {
+		int captureEnd = this->captureStart + this->captureCount;
+
+		if (this->gpuFrame >= captureEnd - 1 || this->currentFrame >= captureEnd - 1 + 2 * GPU_TIMER_FRAMES) {
+			std::vector<frameSample_t> samples;
+
+			for (int i = this->captureStart; i < captureEnd; i++) {
+				frameSample_t* captured = this->getSample(i);
+
+				if (captured != NULL) {
+					samples.push_back(*captured);
+				}
+			}
+
+			this->writeCSV(std::string(FRAME_STATS_PATH) + ".csv", samples);
+			this->writeJSON(std::string(FRAME_STATS_PATH) + ".json", samples);
+			this->captureCount = 0;
+		}
+	}
+}
+
+frameSummary_t FrameStats::summarize(frameMetric_t metric, int frames) {
+	return(summarize(this->getValues(this->getSamples(frames), metric)));
+}
+
+double FrameStats::getOnePercentLow(int frames) {
+	return(getOnePercentLow(this->getValues(this->getSamples(frames), frameTimeMetric)));
+}
+
+std::vector<frameSample_t> FrameStats::getSamples(int frames) {
+	std::vector<frameSample_t> samples;
+
+	for (int i = std::max(this->currentFrame - frames + 1, 0); i <= this->currentFrame; i++) {
+		frameSample_t* sample = this->getSample(i);
+
+		if (sample != NULL) {
+			samples.push_back(*sample);
+		}
+	}
+
+	return(samples);
+}
+
+std::vector<std::string> FrameStats::getPassNames() {
+	return(this->passNames);
+}
+
+std::vector<hitch_t> FrameStats::getHitches() {
+	return(this->hitches);
+}
+
+int FrameStats::getHitchCount() {
+	return(this->hitchCount);
+}
+
+int FrameStats::getFrameCount() {
+	return(this->currentFrame + 1);
+}
+
+void FrameStats::exportFrames() {
+	std::vector<frameSample_t> samples = this->getSamples(FRAME_STATS_FRAMES);
+
+	this->writeCSV(std::string(FRAME_STATS_PATH) + ".csv", samples);
+	this->writeJSON(std::string(FRAME_STATS_PATH) + ".json", samples);
+}
+
+// the frames of a capture have to stay in the ring until their GPU times are back
+void FrameStats::captureFrames(int frames) {
+	this->captureStart = this->currentFrame + 1;
+	this->captureCount = std::min(std::max(frames, 1), FRAME_STATS_FRAMES - 2 * GPU_TIMER_FRAMES);
+}
+
+bool FrameStats::isCapturing() {
+	return(this->captureCount > 0);
+}
+
+int FrameStats::getCaptureRemaining() {
+	return(std::max(this->captureStart + this->captureCount - this->currentFrame - 1, 0));
+}
+
+void FrameStats::writeCSV(std::string path, std::vector<frameSample_t> samples) {
+	std::ofstream file(path);
+
+	if (!file) {
+		printf("frame stats: can't write %s\n", path.c_str());
+		return;
+	}
+
+	// times in milliseconds, empty where there's no value
+	file << "frame,time,frame_ms,cpu_ms,gpu_ms,hitch";
+
+	for (int i = 0; i < this->passNames.size(); i++) {
+		file << "," << this->passNames[i] << " gpu_ms," << this->passNames[i] << " cpu_ms";
+	}
+
+	file << "\n";
+
+	char buffer[64];
+
+	for (int i = 0; i < samples.size(); i++) {
+		frameSample_t sample = samples[i];
+
+		snprintf(buffer, sizeof(buffer), "%d,%.6f,%.4f,%.4f,", sample.frame, sample.time, sample.frameTime * 1000.0, sample.cpuTime * 1000.0);
+		file << buffer;
+
+		if (sample.gpuTime >= 0.0) {
+			snprintf(buffer, sizeof(buffer), "%.4f", sample.gpuTime * 1000.0);
+			file << buffer;
+		}
+
+		file << "," << (sample.hitch ? 1 : 0);
+
+		for (int j = 0; j < this->passNames.size(); j++) {
+			float times[2] = { sample.passGPUTimes[j], sample.passCPUTimes[j] };
+
+			for (int k = 0; k < 2; k++) {
+				file << ",";
+
+				if (times[k] >= 0.0f) {
+					snprintf(buffer, sizeof(buffer), "%.4f", times[k] * 1000.0);
+					file << buffer;
+				}
+			}
+		}
+
+		file << "\n";
+	}
+
+	printf("frame stats: wrote %d frames to %s\n", (int)samples.size(), path.c_str());
+}
+
+static void writeSummary(std::ostream& file, frameSummary_t summary) {
+	char buffer[256];
+
+	snprintf(buffer, sizeof(buffer), "{\"count\":%d,\"mean\":%.4f,\"p50\":%.4f,\"p95\":%.4f,\"p99\":%.4f,\"max\":%.4f}",
+		summary.count, summary.mean * 1000.0, summary.p50 * 1000.0, summary.p95 * 1000.0, summary.p99 * 1000.0, summary.max * 1000.0);
+
+	file << buffer;
+}
+
+void FrameStats::writeJSON(std::string path, std::vector<frameSample_t> samples) {
+	std::ofstream file(path);
+
+	if (!file) {
+		printf("frame stats: can't write %s\n", path.c_str());
+		return;
+	}
+
+	this->writeJSON(file, samples);
+
+	printf("frame stats: wrote %d frames to %s\n", (int)samples.size(), path.c_str());
+}
+
+void FrameStats::writeJSON(std::ostream& file, std::vector<frameSample_t> samples) {
+	std::vector<double> frameTimes = this->getValues(samples, frameTimeMetric);
+	char buffer[128];
+
+	// times in milliseconds
+	file << "{\n\"unit\":\"ms\",\n\"frames\":" << samples.size() << ",\n";
+	file << "\"frameTime\":";
+	writeSummary(file, summarize(frameTimes));
+	file << ",\n\"cpuTime\":";
+	writeSummary(file, summarize(this->getValues(samples, cpuTimeMetric)));
+	file << ",\n\"gpuTime\":";
+	writeSummary(file, summarize(this->getValues(samples, gpuTimeMetric)));
+
+	snprintf(buffer, sizeof(buffer), "%.2f", getOnePercentLow(frameTimes));
+	file << ",\n\"onePercentLowFPS\":" << buffer;
+
+	file << ",\n\"hitches\":[";
+
+	const char* separator = "";
+
+	for (int i = 0; i < samples.size(); i++) {
+		if (samples[i].hitch) {
+			snprintf(buffer, sizeof(buffer), "{\"frame\":%d,\"frameTime\":%.4f}", samples[i].frame, samples[i].frameTime * 1000.0);
+			file << separator << buffer;
+			separator = ",";
+		}
+	}
+
+	file << "],\n\"passes\":[";
+
+	for (int i = 0; i < this->passNames.size(); i++) {
+		std::vector<double> gpuTimes;
+		std::vector<double> cpuTimes;
+
+		for (int j = 0; j < samples.size(); j++) {
+			if (samples[j].passGPUTimes[i] >= 0.0f) {
+				gpuTimes.push_back(samples[j].passGPUTimes[i]);
+				cpuTimes.push_back(samples[j].passCPUTimes[i]);
+			}
+		}
+
+		file << (i > 0 ? ",\n" : "\n") << "{\"name\":\"" << Profiler::escapeJSON(this->passNames[i]) << "\",\"gpu\":";
+		writeSummary(file, summarize(gpuTimes));
+		file << ",\"cpu\":";
+		writeSummary(file, summarize(cpuTimes));
+		file << "}";
+	}
+
+	file << "],\n\"samples\":[";
+
+	for (int i = 0; i < samples.size(); i++) {
+		frameSample_t sample = samples[i];
+
+		snprintf(buffer, sizeof(buffer), "{\"frame\":%d,\"frameTime\":%.4f,\"cpuTime\":%.4f,\"gpuTime\":", sample.frame, sample.frameTime * 1000.0, sample.cpuTime * 1000.0);
+		file << (i > 0 ? ",\n" : "\n") << buffer;
+
+		if (sample.gpuTime >= 0.0) {
+			snprintf(buffer, sizeof(buffer), "%.4f", sample.gpuTime * 1000.0);
+			file << buffer;
+		}
+		else {
+			file << "null";
+		}
+
+		// times of the passes, in the order of the passes list
+		for (int k = 0; k < 2; k++) {
+			file << (k == 0 ? ",\"passGPUTimes\":[" : "],\"passCPUTimes\":[");
+
+			for (int j = 0; j < this->passNames.size(); j++) {
+				float time = k == 0 ? sample.passGPUTimes[j] : sample.passCPUTimes[j];
+
+				if (time >= 0.0f) {
+					snprintf(buffer, sizeof(buffer), "%s%.4f", j > 0 ? "," : "", time * 1000.0);
+				}
+				else {
+					snprintf(buffer, sizeof(buffer), "%snull", j > 0 ? "," : "");
+				}
+
+				file << buffer;
+			}
+		}
+
+		file << "]}";
+	}
+
+	file << "]\n}\n";
+}
+
+frameSummary_t FrameStats::summarize(std::vector<double> values) {
+	frameSummary_t summary = {};
+	summary.count = values.size();
+
+	if (values.empty()) {
+		return(summary);
+	}
+
+	std::sort(values.begin(), values.end());
+
+	double sum = 0.0;
+
+	for (int i = 0; i < values.size(); i++) {
+		sum += values[i];
+	}
+
+	// nearest rank: the smallest value that at least the given fraction of the values doesn't exceed
+	double fractions[3] = { 0.50, 0.95, 0.99 };
+	double percentiles[3];
+
+	for (int i = 0; i < 3; i++) {
+		int rank = (int)ceil(fractions[i] * values.size());
+		percentiles[i] = values[std::max(rank, 1) - 1];
+	}
+
+	summary.mean = sum / values.size();
+	summary.p50 = percentiles[0];
+	summary.p95 = percentiles[1];
+	summary.p99 = percentiles[2];
+	summary.max = values.back();
+
+	return(summary);
+}
+
+double FrameStats::getOnePercentLow(std::vector<double> frameTimes) {
+	if (frameTimes.empty()) {
+		return(0.0);
+	}
+
+	std::sort(frameTimes.begin(), frameTimes.end(), std::greater<double>());
+
+	int slowest = std::max((int)frameTimes.size() / 100, 1);
+	double sum = 0.0;
+
+	for (int i = 0; i < slowest; i++) {
+		sum += frameTimes[i];
+	}
+
+	return(sum > 0.0 ? slowest / sum : 0.0);
+}
+
+frameSample_t* FrameStats::getSample(int frame) {
+	if (frame < 0) {
+		return(NULL);
+	}
+
+	frameSample_t* sample = &this->samples[frame % FRAME_STATS_FRAMES];
+
+	return(sample->frame == frame ? sample : NULL);
+}
+
+int FrameStats::getPassColumn(std::string name) {
+	for (int i = 0; i < this->passNames.size(); i++) {
+		if (this->passNames[i] == name) {
+			return(i);
+		}
+	}
+
+	if (this->passNames.size() >= FRAME_STATS_PASSES) {
+		return(-1);
+	}
+
+	this->passNames.push_back(name);
+
+	return(this->passNames.size() - 1);
+}
+
+// the first frame has no previous one to measure from, so its frame time is left out
+std::vector<double> FrameStats::getValues(std::vector<frameSample_t> samples, frameMetric_t metric) {
+	std::vector<double> values;
+
+	for (int i = 0; i < samples.size(); i++) {
+		double value = metric == frameTimeMetric ? samples[i].frameTime : metric == cpuTimeMetric ? samples[i].cpuTime : samples[i].gpuTime;
+
+		if (value > 0.0) {
+			values.push_back(value);
+		}
+	}
+
+	return(values);
+}
+
+void FrameStats::updateMedian() {
+	frameSummary_t summary = this->summarize(frameTimeMetric, FRAME_STATS_MEDIAN_FRAMES);
+
+	this->median = summary.p50;
+}
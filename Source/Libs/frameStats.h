@@ -0,0 +1,126 @@
+#ifndef __FRAMESTATS__
+#define __FRAMESTATS__
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include "gpuTimer.h"
+
+// frames kept in the ring, about a minute at 60 fps
+#define FRAME_STATS_FRAMES 4096
+// passes with their own column, the ones after are left out
+#define FRAME_STATS_PASSES 16
+// a frame that takes this many times the median of the frames before it is a hitch
+#define FRAME_STATS_HITCH_FACTOR 2.0
+// if it's also at least this much longer than the median (s), so a fast frame rate doesn't count every small variation
+#define FRAME_STATS_HITCH_MIN 0.004
+// frames between two updates of the median used for hitch detection, and frames it's taken over
+#define FRAME_STATS_MEDIAN_INTERVAL 30
+#define FRAME_STATS_MEDIAN_FRAMES 300
+#define FRAME_STATS_HITCH_HISTORY 16
+// the exports are written to this path with a .csv and a .json extension
+#define FRAME_STATS_PATH "../frameStats"
+
+// what a frame took (s), the pass times are -1 for passes that didn't run or whose queries were dropped
+typedef struct {
+	int frame;
+	// time the frame ended at, since the program started
+	double time;
+	// time since the end of the previous frame
+	double frameTime;
+	// CPU time spent in render(), and GPU time of the passes, -1 until the GPU results of the frame are back
+	double cpuTime;
+	double gpuTime;
+	float passGPUTimes[FRAME_STATS_PASSES];
+	float passCPUTimes[FRAME_STATS_PASSES];
+	bool hitch;
+} frameSample_t;
+
+// distribution of a time over a range of frames (s)
+typedef struct {
+	int count;
+	double mean;
+	double p50;
+	double p95;
+	double p99;
+	double max;
+} frameSummary_t;
+
+typedef struct {
+	int frame;
+	double frameTime;
+	// median the frame was compared to
+	double median;
+} hitch_t;
+
+enum frameMetric_t {
+	frameTimeMetric,
+	cpuTimeMetric,
+	gpuTimeMetric
+};
+
+// class recording the times of every frame in a ring, for percentiles of the recent frames, hitch detection and
+// exporting to CSV and JSON. The GPU times of a frame come back a few frames after it was drawn, they're filled into
+// its sample when they arrive
+class FrameStats {
+	public:
+		// constructor method
+		FrameStats();
+
+		// method for recording the frame the timer just finished (CPU time of the frame (s), timer of the passes)
+		void record(double, GPUTimer*);
+
+		// distribution of a metric over the last frames recorded (metric, frames), the frames without a value skipped
+		frameSummary_t summarize(frameMetric_t, int);
+		// fps of the slowest 1% of the last frames (frames)
+		double getOnePercentLow(int);
+		// last samples, the oldest first (frames)
+		std::vector<frameSample_t> getSamples(int);
+		std::vector<std::string> getPassNames();
+		// last hitches, the most recent first
+		std::vector<hitch_t> getHitches();
+		int getHitchCount();
+		int getFrameCount();
+
+		// method for writing all the frames in the ring to FRAME_STATS_PATH
+		void exportFrames();
+		// method for writing the next given number of frames to FRAME_STATS_PATH once they're recorded
+		void captureFrames(int);
+		bool isCapturing();
+		// frames left to record in the capture
+		int getCaptureRemaining();
+
+		// methods for writing samples (path, samples) as one row per frame, or with their summary as JSON
+		void writeCSV(std::string, std::vector<frameSample_t>);
+		void writeJSON(std::string, std::vector<frameSample_t>);
+		// method for writing the JSON object of samples into a stream (stream, samples), for reports that embed it
+		void writeJSON(std::ostream&, std::vector<frameSample_t>);
+
+		// distribution of a list of times (s), using the nearest rank for the percentiles
+		static frameSummary_t summarize(std::vector<double>);
+		// fps of the slowest 1% of a list of frame times (s)
+		static double getOnePercentLow(std::vector<double>);
+
+	private:
+		std::vector<frameSample_t> samples;
+		std::vector<std::string> passNames;
+		// last frame recorded, and last frame whose GPU times were filled in
+		int currentFrame;
+		int gpuFrame;
+		double lastTime;
+		double median;
+		std::vector<hitch_t> hitches;
+		int hitchCount;
+		int captureStart;
+		int captureCount;
+
+		// sample of a frame still in the ring, NULL if it was overwritten
+		frameSample_t* getSample(int);
+		// column of a pass, added the first time the pass runs, -1 if there's no column left
+		int getPassColumn(std::string);
+		// values of a metric for the given samples, without the missing ones
+		std::vector<double> getValues(std::vector<frameSample_t>, frameMetric_t);
+		void updateMedian();
+};
+
+#endif
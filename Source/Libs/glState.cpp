@@ -0,0 +1,786 @@
+#include "glState.h"
+#include <algorithm>
+
+// constructor method
+GLState::GLState() {
+	this->issuedCalls = 0;
+	this->elidedCalls = 0;
+	this->lastIssuedCalls = 0;
+	this->lastElidedCalls = 0;
+	this->cachedLocations = 0;
+	this->lastCachedLocations = 0;
+
+	this->invalidate();
+}
+
+void GLState::beginFrame() {
+	this->lastIssuedCalls = this->issuedCalls;
+	this->lastElidedCalls = this->elidedCalls;
+	this->lastCachedLocations = this->cachedLocations;
+	this->issuedCalls = 0;
+	this->elidedCalls = 0;
+	this->cachedLocations = 0;
+
+	this->invalidate();
+}
+
+void GLState::invalidate() {
+	this->enables.clear();
+	this->program = -1;
+	this->drawFramebuffer = -1;
+	this->readFramebuffer = -1;
+	this->activeUnit = -1;
+	this->buffers.clear();
+	this->bufferBases.clear();
+	this->textures.clear();
+	this->units.clear();
+
+	this->depthMaskValue = -1;
+	this->depthFuncValue = -1;
+	this->stencilMaskValue = -1;
+	this->blendSource = -1;
+	this->blendDestination = -1;
+	this->viewportKnown = false;
+}
+
+void GLState::enable(GLenum capability) {
+	this->setEnabled(capability, true);
+}
+
+void GLState::disable(GLenum capability) {
+	this->setEnabled(capability, false);
+}
+
+void GLState::setEnabled(GLenum capability, bool enabled) {
+	std::map<GLenum, int>::iterator current = this->enables.find(capability);
+
+	if (current != this->enables.end() && current->second == (int)enabled) {
+		this->elidedCalls++;
+		return;
+	}
+
+	if (enabled) {
+		glEnable(capability);
+	}
+	else {
+		glDisable(capability);
+	}
+
+	this->enables[capability] = enabled;
+	this->issuedCalls++;
+}
+
+void GLState::depthMask(GLboolean flag) {
+	if (this->depthMaskValue == flag) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glDepthMask(flag);
+	this->depthMaskValue = flag;
+	this->issuedCalls++;
+}
+
+void GLState::depthFunc(GLenum function) {
+	if (this->depthFuncValue == function) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glDepthFunc(function);
+	this->depthFuncValue = function;
+	this->issuedCalls++;
+}
+
+void GLState::stencilMask(GLuint mask) {
+	if (this->stencilMaskValue == mask) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glStencilMask(mask);
+	this->stencilMaskValue = mask;
+	this->issuedCalls++;
+}
+
+void GLState::blendFunc(GLenum source, GLenum destination) {
+	if (this->blendSource == source && this->blendDestination == destination) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glBlendFunc(source, destination);
+	this->blendSource = source;
+	this->blendDestination = destination;
+	this->issuedCalls++;
+}
+
+void GLState::viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	if (this->viewportKnown && this->viewportValue[0] == x && this->viewportValue[1] == y &&
+		this->viewportValue[2] == width && this->viewportValue[3] == height) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glViewport(x, y, width, height);
+	this->viewportValue[0] = x;
+	this->viewportValue[1] = y;
+	this->viewportValue[2] = width;
+	this->viewportValue[3] = height;
+	this->viewportKnown = true;
+	this->issuedCalls++;
+}
+
+void GLState::useProgram(GLuint id) {
+	if (this->program == id) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glUseProgram(id);
+	this->program = id;
+	this->issuedCalls++;
+}
+
+void GLState::bindFramebuffer(GLenum target, GLuint id) {
+	bool draw = target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER;
+	bool read = target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER;
+
+	if ((!draw || this->drawFramebuffer == id) && (!read || this->readFramebuffer == id)) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glBindFramebuffer(target, id);
+
+	if (draw) {
+		this->drawFramebuffer = id;
+	}
+
+	if (read) {
+		this->readFramebuffer = id;
+	}
+
+	this->issuedCalls++;
+}
+
+void GLState::bindBuffer(GLenum target, GLuint id) {
+	std::map<GLenum, long long>::iterator current = this->buffers.find(target);
+
+	if (current != this->buffers.end() && current->second == id) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glBindBuffer(target, id);
+	this->buffers[target] = id;
+	this->issuedCalls++;
+}
+
+void GLState::bindBufferBase(GLenum target, GLuint index, GLuint id) {
+	std::pair<GLenum, GLuint> key(target, index);
+	std::map<std::pair<GLenum, GLuint>, GLuint>::iterator current = this->bufferBases.find(key);
+
+	if (current != this->bufferBases.end() && current->second == id) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glBindBufferBase(target, index, id);
+	this->bufferBases[key] = id;
+	this->buffers[target] = id;
+	this->issuedCalls++;
+}
+
+void GLState::activeTexture(GLenum unit) {
+	if (this->activeUnit == unit) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glActiveTexture(unit);
+	this->activeUnit = unit;
+	this->issuedCalls++;
+}
+
+void GLState::bindTexture(GLenum target, GLuint id) {
+	// the unit is needed to track the binding and to bind the sampler next to the texture
+	if (this->activeUnit < 0) {
+		GLint unit;
+		glGetIntegerv(GL_ACTIVE_TEXTURE, &unit);
+		this->activeUnit = unit;
+	}
+
+	std::map<GLuint, GLuint>::iterator sampler = this->textureSamplers.find(id);
+	this->bindSampler((GLenum)this->activeUnit, sampler != this->textureSamplers.end() ? sampler->second : 0);
+
+	std::pair<GLenum, GLenum> key((GLenum)this->activeUnit, target);
+	std::map<std::pair<GLenum, GLenum>, GLuint>::iterator current = this->textures.find(key);
+
+	if (current != this->textures.end() && current->second == id) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glBindTexture(target, id);
+	this->textures[key] = id;
+	this->issuedCalls++;
+}
+
+void GLState::bindSampler(GLenum unit, GLuint sampler) {
+	std::map<GLenum, GLuint>::iterator current = this->units.find(unit);
+
+	if (current != this->units.end() && current->second == sampler) {
+		this->elidedCalls++;
+		return;
+	}
+
+	glBindSampler(unit - GL_TEXTURE0, sampler);
+	this->units[unit] = sampler;
+	this->issuedCalls++;
+}
+
+GLint GLState::getUniformLocation(GLuint id, const GLchar* name) {
+	std::pair<GLuint, std::string> key(id, name);
+	std::map<std::pair<GLuint, std::string>, GLint>::iterator cached = this->locations.find(key);
+
+	// a lookup isn't state, so it's counted apart from the elided calls
+	if (cached != this->locations.end()) {
+		this->cachedLocations++;
+		return(cached->second);
+	}
+
+	GLint location = glGetUniformLocation(id, name);
+	this->locations[key] = location;
+	this->issuedCalls++;
+
+	return(location);
+}
+
+bool GLState::uniformChanged(GLint location, const void* value, size_t size) {
+	// uniforms that don't exist are ignored by openGL anyway
+	if (location < 0) {
+		this->elidedCalls++;
+		return(false);
+	}
+
+	// the value can only be tracked for a known program
+	if (this->program < 0) {
+		this->issuedCalls++;
+		return(true);
+	}
+
+	std::pair<GLuint, GLint> key((GLuint)this->program, location);
+	std::string bytes((const char*)value, size);
+	std::map<std::pair<GLuint, GLint>, std::string>::iterator current = this->uniforms.find(key);
+
+	if (current != this->uniforms.end() && current->second == bytes) {
+		this->elidedCalls++;
+		return(false);
+	}
+
+	this->uniforms[key] = bytes;
+	this->issuedCalls++;
+
+	return(true);
+}
+
+void GLState::uniform1i(GLint location, GLint x) {
+	if (this->uniformChanged(location, &x, sizeof(x))) {
+		glUniform1i(location, x);
+	}
+}
+
+void GLState::uniform1ui(GLint location, GLuint x) {
+	if (this->uniformChanged(location, &x, sizeof(x))) {
+		glUniform1ui(location, x);
+	}
+}
+
+void GLState::uniform2i(GLint location, GLint x, GLint y) {
+	GLint value[2] = { x, y };
+
+	if (this->uniformChanged(location, value, sizeof(value))) {
+		glUniform2i(location, x, y);
+	}
+}
+
+void GLState::uniform3i(GLint location, GLint x, GLint y, GLint z) {
+	GLint value[3] = { x, y, z };
+
+	if (this->uniformChanged(location, value, sizeof(value))) {
+		glUniform3i(location, x, y, z);
+	}
+}
+
+void GLState::uniform1f(GLint location, GLfloat x) {
+	if (this->uniformChanged(location, &x, sizeof(x))) {
+		glUniform1f(location, x);
+	}
+}
+
+void GLState::uniform2f(GLint location, GLfloat x, GLfloat y) {
+	GLfloat value[2] = { x, y };
+
+	if (this->uniformChanged(location, value, sizeof(value))) {
+		glUniform2f(location, x, y);
+	}
+}
+
+void GLState::uniform3f(GLint location, GLfloat x, GLfloat y, GLfloat z) {
+	GLfloat value[3] = { x, y, z };
+
+	if (this->uniformChanged(location, value, sizeof(value))) {
+		glUniform3f(location, x, y, z);
+	}
+}
+
+void GLState::uniform1fv(GLint location, GLsizei count, const GLfloat* value) {
+	if (this->uniformChanged(location, value, count * sizeof(GLfloat))) {
+		glUniform1fv(location, count, value);
+	}
+}
+
+void GLState::uniform4fv(GLint location, GLsizei count, const GLfloat* value) {
+	if (this->uniformChanged(location, value, count * 4 * sizeof(GLfloat))) {
+		glUniform4fv(location, count, value);
+	}
+}
+
+void GLState::uniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
+	// a transposed upload of the same floats is a different value, so the flag is part of it
+	std::string bytes((const char*)value, count * 16 * sizeof(GLfloat));
+	bytes += (char)transpose;
+
+	if (this->uniformChanged(location, bytes.data(), bytes.size())) {
+		glUniformMatrix4fv(location, count, transpose, value);
+	}
+}
+
+void GLState::deleteTextures(GLsizei count, const GLuint* ids) {
+	for (int i = 0; i < count; i++) {
+		this->textureSamplers.erase(ids[i]);
+
+		std::map<std::pair<GLenum, GLenum>, GLuint>::iterator it;
+
+		for (it = this->textures.begin(); it != this->textures.end(); it++) {
+			if (it->second == ids[i]) {
+				it->second = 0;
+			}
+		}
+	}
+
+	glDeleteTextures(count, ids);
+	this->issuedCalls++;
+}
+
+void GLState::deleteFramebuffers(GLsizei count, const GLuint* ids) {
+	for (int i = 0; i < count; i++) {
+		if (this->drawFramebuffer == ids[i]) {
+			this->drawFramebuffer = 0;
+		}
+
+		if (this->readFramebuffer == ids[i]) {
+			this->readFramebuffer = 0;
+		}
+	}
+
+	glDeleteFramebuffers(count, ids);
+	this->issuedCalls++;
+}
+
+void GLState::deleteBuffers(GLsizei count, const GLuint* ids) {
+	for (int i = 0; i < count; i++) {
+		std::map<GLenum, long long>::iterator it;
+
+		for (it = this->buffers.begin(); it != this->buffers.end(); it++) {
+			if (it->second == ids[i]) {
+				it->second = 0;
+			}
+		}
+
+		std::map<std::pair<GLenum, GLuint>, GLuint>::iterator base;
+
+		for (base = this->bufferBases.begin(); base != this->bufferBases.end(); base++) {
+			if (base->second == ids[i]) {
+				base->second = 0;
+			}
+		}
+	}
+
+	glDeleteBuffers(count, ids);
+	this->issuedCalls++;
+}
+
+void GLState::forgetProgram(GLuint id) {
+	std::map<std::pair<GLuint, GLint>, std::string>::iterator uniform = this->uniforms.begin();
+
+	while (uniform != this->uniforms.end()) {
+		if (uniform->first.first == id) {
+			uniform = this->uniforms.erase(uniform);
+		}
+		else {
+			uniform++;
+		}
+	}
+
+	std::map<std::pair<GLuint, std::string>, GLint>::iterator location = this->locations.begin();
+
+	while (location != this->locations.end()) {
+		if (location->first.first == id) {
+			location = this->locations.erase(location);
+		}
+		else {
+			location++;
+		}
+	}
+
+	if (this->program == id) {
+		this->program = -1;
+	}
+}
+
+bool GLState::hasDirectStateAccess() {
+	return(GLAD_GL_VERSION_4_5 != 0);
+}
+
+GLuint GLState::createBuffer(GLsizeiptr size, const void* data, GLbitfield flags) {
+	GLuint buffer;
+
+	if (this->hasDirectStateAccess()) {
+		glCreateBuffers(1, &buffer);
+		glNamedBufferStorage(buffer, size, data, flags);
+
+		return(buffer);
+	}
+
+	glGenBuffers(1, &buffer);
+	this->bindBuffer(GL_ARRAY_BUFFER, buffer);
+
+	if (GLAD_GL_VERSION_4_4) {
+		glBufferStorage(GL_ARRAY_BUFFER, size, data, flags);
+	}
+	else {
+		glBufferData(GL_ARRAY_BUFFER, size, data, (flags & GL_DYNAMIC_STORAGE_BIT) ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+	}
+
+	return(buffer);
+}
+
+void GLState::bufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data) {
+	if (this->hasDirectStateAccess()) {
+		glNamedBufferSubData(buffer, offset, size, data);
+		return;
+	}
+
+	this->bindBuffer(GL_ARRAY_BUFFER, buffer);
+	glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+}
+
+void* GLState::mapBuffer(GLuint buffer, GLsizeiptr size, GLbitfield access) {
+	if (this->hasDirectStateAccess()) {
+		return(glMapNamedBufferRange(buffer, 0, size, access));
+	}
+
+	this->bindBuffer(GL_ARRAY_BUFFER, buffer);
+	return(glMapBufferRange(GL_ARRAY_BUFFER, 0, size, access));
+}
+
+GLuint GLState::createTexture(GLenum target, GLenum format, GLsizei width, GLsizei height, GLsizei levels, GLsizei samples) {
+	GLuint texture;
+
+	if (this->hasDirectStateAccess()) {
+		glCreateTextures(target, 1, &texture);
+
+		if (target == GL_TEXTURE_2D_MULTISAMPLE) {
+			glTextureStorage2DMultisample(texture, samples, format, width, height, GL_FALSE);
+		}
+		else {
+			glTextureStorage2D(texture, levels, format, width, height);
+		}
+
+		return(texture);
+	}
+
+	glGenTextures(1, &texture);
+	this->bindTexture(target, texture);
+
+	if (target == GL_TEXTURE_2D_MULTISAMPLE) {
+		if (GLAD_GL_VERSION_4_3) {
+			glTexStorage2DMultisample(target, samples, format, width, height, GL_FALSE);
+		}
+		else {
+			glTexImage2DMultisample(target, samples, format, width, height, GL_FALSE);
+		}
+
+		return(texture);
+	}
+
+	if (GLAD_GL_VERSION_4_2) {
+		glTexStorage2D(target, levels, format, width, height);
+
+		return(texture);
+	}
+
+	// mutable storage: every level (and face) is specified on its own, and the levels past the last one are cut off
+	// so the texture is complete
+	GLenum pixelFormat;
+	GLenum pixelType;
+	this->getPixelFormat(format, &pixelFormat, &pixelType);
+
+	for (int level = 0; level < levels; level++) {
+		GLsizei levelWidth = std::max(width >> level, 1);
+		GLsizei levelHeight = std::max(height >> level, 1);
+
+		if (target == GL_TEXTURE_CUBE_MAP) {
+			for (int face = 0; face < 6; face++) {
+				glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, format, levelWidth, levelHeight, 0, pixelFormat, pixelType, NULL);
+			}
+		}
+		else {
+			glTexImage2D(target, level, format, levelWidth, levelHeight, 0, pixelFormat, pixelType, NULL);
+		}
+	}
+
+	glTexParameteri(target, GL_TEXTURE_BASE_LEVEL, 0);
+	glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, levels - 1);
+
+	return(texture);
+}
+
+void GLState::textureSubImage(GLuint texture, GLenum target, GLint level, GLint face, GLsizei width, GLsizei height,
+	GLenum format, GLenum type, const void* data) {
+	if (this->hasDirectStateAccess()) {
+		// cubemaps are edited as arrays of 6 layers
+		if (target == GL_TEXTURE_CUBE_MAP) {
+			glTextureSubImage3D(texture, level, 0, 0, face, width, height, 1, format, type, data);
+		}
+		else {
+			glTextureSubImage2D(texture, level, 0, 0, width, height, format, type, data);
+		}
+
+		return;
+	}
+
+	this->bindTexture(target, texture);
+
+	if (target == GL_TEXTURE_CUBE_MAP) {
+		glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, 0, 0, width, height, format, type, data);
+	}
+	else {
+		glTexSubImage2D(target, level, 0, 0, width, height, format, type, data);
+	}
+}
+
+void GLState::generateMipmap(GLuint texture, GLenum target) {
+	if (this->hasDirectStateAccess()) {
+		glGenerateTextureMipmap(texture);
+		return;
+	}
+
+	this->bindTexture(target, texture);
+	glGenerateMipmap(target);
+}
+
+void GLState::textureParameteri(GLuint texture, GLenum target, GLenum name, GLint value) {
+	if (this->hasDirectStateAccess()) {
+		glTextureParameteri(texture, name, value);
+		return;
+	}
+
+	this->bindTexture(target, texture);
+	glTexParameteri(target, name, value);
+}
+
+GLuint GLState::createRenderbuffer(GLenum format, GLsizei samples, GLsizei width, GLsizei height) {
+	GLuint renderbuffer;
+
+	if (this->hasDirectStateAccess()) {
+		glCreateRenderbuffers(1, &renderbuffer);
+		glNamedRenderbufferStorageMultisample(renderbuffer, samples, format, width, height);
+
+		return(renderbuffer);
+	}
+
+	glGenRenderbuffers(1, &renderbuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+	glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, format, width, height);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	return(renderbuffer);
+}
+
+GLuint GLState::createFramebuffer() {
+	GLuint framebuffer;
+
+	if (this->hasDirectStateAccess()) {
+		glCreateFramebuffers(1, &framebuffer);
+	}
+	else {
+		glGenFramebuffers(1, &framebuffer);
+	}
+
+	return(framebuffer);
+}
+
+void GLState::framebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint face) {
+	if (this->hasDirectStateAccess()) {
+		if (face >= 0) {
+			glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, face);
+		}
+		else {
+			glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+		}
+
+		return;
+	}
+
+	this->bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+	if (face >= 0) {
+		glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, texture, level);
+	}
+	else {
+		glFramebufferTexture(GL_FRAMEBUFFER, attachment, texture, level);
+	}
+}
+
+void GLState::framebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLuint renderbuffer) {
+	if (this->hasDirectStateAccess()) {
+		glNamedFramebufferRenderbuffer(framebuffer, attachment, GL_RENDERBUFFER, renderbuffer);
+		return;
+	}
+
+	this->bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, attachment, GL_RENDERBUFFER, renderbuffer);
+}
+
+void GLState::framebufferDrawBuffer(GLuint framebuffer, GLenum buffer) {
+	if (this->hasDirectStateAccess()) {
+		glNamedFramebufferDrawBuffer(framebuffer, buffer);
+		glNamedFramebufferReadBuffer(framebuffer, buffer);
+		return;
+	}
+
+	this->bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glDrawBuffer(buffer);
+	glReadBuffer(buffer);
+}
+
+GLenum GLState::checkFramebufferStatus(GLuint framebuffer) {
+	if (this->hasDirectStateAccess()) {
+		return(glCheckNamedFramebufferStatus(framebuffer, GL_FRAMEBUFFER));
+	}
+
+	this->bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	return(glCheckFramebufferStatus(GL_FRAMEBUFFER));
+}
+
+GLuint GLState::getSampler(GLenum minFilter, GLenum magFilter, GLenum wrap) {
+	std::vector<GLenum> key;
+	key.push_back(minFilter);
+	key.push_back(magFilter);
+	key.push_back(wrap);
+
+	std::map<std::vector<GLenum>, GLuint>::iterator cached = this->samplers.find(key);
+
+	if (cached != this->samplers.end()) {
+		return(cached->second);
+	}
+
+	GLuint sampler;
+
+	if (this->hasDirectStateAccess()) {
+		glCreateSamplers(1, &sampler);
+	}
+	else {
+		glGenSamplers(1, &sampler);
+	}
+
+	glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, minFilter);
+	glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, magFilter);
+	glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, wrap);
+	glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, wrap);
+	glSamplerParameteri(sampler, GL_TEXTURE_WRAP_R, wrap);
+
+	this->samplers[key] = sampler;
+
+	return(sampler);
+}
+
+void GLState::setTextureSampler(GLuint texture, GLuint sampler) {
+	this->textureSamplers[texture] = sampler;
+}
+
+GLuint GLState::getTextureSampler(GLuint texture) {
+	std::map<GLuint, GLuint>::iterator sampler = this->textureSamplers.find(texture);
+
+	if (sampler == this->textureSamplers.end()) {
+		return(0);
+	}
+
+	return(sampler->second);
+}
+
+int GLState::getMipLevels(int width, int height) {
+	int levels = 1;
+	int size = std::max(width, height);
+
+	while (size > 1) {
+		size /= 2;
+		levels++;
+	}
+
+	return(levels);
+}
+
+void GLState::getPixelFormat(GLenum format, GLenum* pixelFormat, GLenum* pixelType) {
+	// no data is uploaded, the format and type only need to be compatible with the internal format
+	switch (format) {
+	case GL_DEPTH24_STENCIL8:
+		*pixelFormat = GL_DEPTH_STENCIL;
+		*pixelType = GL_UNSIGNED_INT_24_8;
+		break;
+
+	case GL_R32F:
+		*pixelFormat = GL_RED;
+		*pixelType = GL_FLOAT;
+		break;
+
+	case GL_RG16F:
+		*pixelFormat = GL_RG;
+		*pixelType = GL_FLOAT;
+		break;
+
+	case GL_RG16I:
+		*pixelFormat = GL_RG_INTEGER;
+		*pixelType = GL_SHORT;
+		break;
+
+	case GL_RGBA16F:
+		*pixelFormat = GL_RGBA;
+		*pixelType = GL_FLOAT;
+		break;
+
+	case GL_RGBA8:
+		*pixelFormat = GL_RGBA;
+		*pixelType = GL_UNSIGNED_BYTE;
+		break;
+
+	default:
+		*pixelFormat = GL_RGB;
+		*pixelType = GL_UNSIGNED_BYTE;
+	}
+}
+
+int GLState::getIssuedCalls() {
+	return(this->lastIssuedCalls);
+}
+
+int GLState::getElidedCalls() {
+	return(this->lastElidedCalls);
+}
+
+int GLState::getCachedLocations() {
+	return(this->lastCachedLocations);
+}
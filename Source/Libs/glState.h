@@ -0,0 +1,140 @@
+#ifndef __GLSTATE__
+#define __GLSTATE__
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include <glad\glad.h>
+
+// class shadowing the openGL state the renderer changes the most (bindings, enables, uniform values), so that calls
+// that wouldn't change anything are skipped. Every binding is unknown at the start of a frame, since code outside the
+// renderer (ui, loading) can change them, while uniform values live in the programs and are kept across frames
+class GLState {
+	public:
+		// constructor method, doesn't touch openGL so it can run before the context exists
+		GLState();
+
+		// method for starting a frame: forgets the bindings and moves the call counters to the last frame ones
+		void beginFrame();
+		// method for forgetting every binding and enable, after code that doesn't go through the cache
+		void invalidate();
+
+		void enable(GLenum);
+		void disable(GLenum);
+		void depthMask(GLboolean);
+		void depthFunc(GLenum);
+		void stencilMask(GLuint);
+		void blendFunc(GLenum, GLenum);
+		void viewport(GLint, GLint, GLsizei, GLsizei);
+
+		void useProgram(GLuint);
+		void bindFramebuffer(GLenum, GLuint);
+		void bindBuffer(GLenum, GLuint);
+		// binding point of a shader storage or uniform buffer (target, index, buffer), also binds the target
+		void bindBufferBase(GLenum, GLuint, GLuint);
+		void activeTexture(GLenum);
+		void bindTexture(GLenum, GLuint);
+
+		// location of a uniform, looked up only the first time for every program
+		GLint getUniformLocation(GLuint, const GLchar*);
+		// uniforms of the bound program, skipped when the program already has the same value
+		void uniform1i(GLint, GLint);
+		void uniform1ui(GLint, GLuint);
+		void uniform2i(GLint, GLint, GLint);
+		void uniform3i(GLint, GLint, GLint, GLint);
+		void uniform1f(GLint, GLfloat);
+		void uniform2f(GLint, GLfloat, GLfloat);
+		void uniform3f(GLint, GLfloat, GLfloat, GLfloat);
+		void uniform1fv(GLint, GLsizei, const GLfloat*);
+		void uniform4fv(GLint, GLsizei, const GLfloat*);
+		void uniformMatrix4fv(GLint, GLsizei, GLboolean, const GLfloat*);
+
+		// deleting objects through the cache drops them from the shadowed bindings, so a recycled name isn't skipped
+		void deleteTextures(GLsizei, const GLuint*);
+		void deleteFramebuffers(GLsizei, const GLuint*);
+		void deleteBuffers(GLsizei, const GLuint*);
+		// method for forgetting the uniform values and locations of a program that's deleted or linked again
+		void forgetProgram(GLuint);
+
+		// checks if objects can be edited without binding them (openGL 4.5), otherwise they're bound through the cache
+		bool hasDirectStateAccess();
+		// immutable buffer (size, data, storage flags), with mutable storage below openGL 4.4
+		GLuint createBuffer(GLsizeiptr, const void*, GLbitfield);
+		void bufferSubData(GLuint, GLintptr, GLsizeiptr, const void*);
+		void* mapBuffer(GLuint, GLsizeiptr, GLbitfield);
+		// immutable texture (target, internal format, width, height, levels, samples), GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP
+		// or GL_TEXTURE_2D_MULTISAMPLE, with mutable storage below openGL 4.2
+		GLuint createTexture(GLenum, GLenum, GLsizei, GLsizei, GLsizei, GLsizei);
+		// upload to a level of a texture (texture, target, level, cubemap face, width, height, format, type, data)
+		void textureSubImage(GLuint, GLenum, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void*);
+		void generateMipmap(GLuint, GLenum);
+		void textureParameteri(GLuint, GLenum, GLenum, GLint);
+		GLuint createRenderbuffer(GLenum, GLsizei, GLsizei, GLsizei);
+		GLuint createFramebuffer();
+		// attach a level of a texture to a framebuffer (framebuffer, attachment, texture, level, cubemap face or -1)
+		void framebufferTexture(GLuint, GLenum, GLuint, GLint, GLint);
+		void framebufferRenderbuffer(GLuint, GLenum, GLuint);
+		// draw and read buffer of a framebuffer, GL_NONE for depth only framebuffers
+		void framebufferDrawBuffer(GLuint, GLenum);
+		GLenum checkFramebufferStatus(GLuint);
+
+		// shared sampler object (min filter, mag filter, wrap), created the first time it's asked for
+		GLuint getSampler(GLenum, GLenum, GLenum);
+		// sampler bound together with the texture on its unit by bindTexture, 0 to use the texture parameters
+		void setTextureSampler(GLuint, GLuint);
+		GLuint getTextureSampler(GLuint);
+		// number of levels of a full mipmap chain (width, height)
+		static int getMipLevels(int, int);
+
+		// calls that reached openGL and calls that were skipped, during the last complete frame
+		int getIssuedCalls();
+		int getElidedCalls();
+		// uniform locations found in the cache instead of asked to openGL, during the last complete frame
+		int getCachedLocations();
+
+	private:
+		// -1 while unknown
+		std::map<GLenum, int> enables;
+		long long program;
+		long long drawFramebuffer;
+		long long readFramebuffer;
+		long long activeUnit;
+		std::map<GLenum, long long> buffers;
+		// buffer bound to every indexed binding point, by target and index
+		std::map<std::pair<GLenum, GLuint>, GLuint> bufferBases;
+		// bound texture by texture unit and target
+		std::map<std::pair<GLenum, GLenum>, GLuint> textures;
+		// bound sampler by texture unit, and the sampler of every texture that has one
+		std::map<GLenum, GLuint> units;
+		std::map<GLuint, GLuint> textureSamplers;
+		std::map<std::vector<GLenum>, GLuint> samplers;
+
+		int depthMaskValue;
+		long long depthFuncValue;
+		long long stencilMaskValue;
+		long long blendSource;
+		long long blendDestination;
+		GLint viewportValue[4];
+		bool viewportKnown;
+
+		// uniform locations and the bytes of the last value set, by program
+		std::map<std::pair<GLuint, std::string>, GLint> locations;
+		std::map<std::pair<GLuint, GLint>, std::string> uniforms;
+
+		int issuedCalls;
+		int elidedCalls;
+		int lastIssuedCalls;
+		int lastElidedCalls;
+		int cachedLocations;
+		int lastCachedLocations;
+
+		// checks if the value differs from the one the bound program has, and records it (location, value, bytes)
+		bool uniformChanged(GLint, const void*, size_t);
+		void setEnabled(GLenum, bool);
+		void bindSampler(GLenum, GLuint);
+		// pixel format and type compatible with an internal format, for the storage of the fallback path
+		void getPixelFormat(GLenum, GLenum*, GLenum*);
+};
+
+#endif
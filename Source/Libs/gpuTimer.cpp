@@ -0,0 +1,170 @@
+#include "gpuTimer.h"
+#include <glad\glad.h>
+#include "GLFW\glfw3.h"
+#include <algorithm>
+
+// constructor method
+GPUTimer::GPUTimer() {
+	for (int i = 0; i < GPU_TIMER_FRAMES; i++) {
+		glGenQueries(2 * GPU_TIMER_SECTIONS, this->frames[i].queries);
+		this->frames[i].count = 0;
+		this->frames[i].issued = false;
+	}
+
+	this->current = 0;
+	this->droppedFrames = 0;
+	this->frameCount = 0;
+	this->lastFrame = -1;
+	this->lastFrameTime = 0.0;
+}
+
+void GPUTimer::beginFrame() {
+	gpuTimerFrame_t* frame = &this->frames[this->current];
+
+	if (frame->issued && frame->count > 0) {
+		// timestamps complete in order, so the end of the last outer section (issued after the ones nested in it)
+		// being there means the whole frame is
+		int last = frame->count - 1;
+
+		while (last > 0 && frame->depths[last] > 0) {
+			last--;
+		}
+
+		int available = 0;
+		glGetQueryObjectiv(frame->queries[2 * last + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+		if (available) {
+			this->readFrame(frame);
+		}
+		else {
+			this->droppedFrames++;
+		}
+	}
+
+	frame->count = 0;
+	frame->issued = false;
+}
+
+// the slot is taken when the section begins, so the sections are kept in the order they started
+void GPUTimer::begin(std::string name) {
+	gpuTimerFrame_t* frame = &this->frames[this->current];
+	int section = -1;
+
+	if (frame->count < GPU_TIMER_SECTIONS) {
+		section = frame->count;
+		frame->names[section] = name;
+		frame->depths[section] = this->openSections.size();
+		glQueryCounter(frame->queries[2 * section], GL_TIMESTAMP);
+		frame->count++;
+	}
+
+	this->openSections.push_back(section);
+	this->sectionStarts.push_back(glfwGetTime());
+}
+
+void GPUTimer::end() {
+	if (this->openSections.empty()) {
+		return;
+	}
+
+	gpuTimerFrame_t* frame = &this->frames[this->current];
+	int section = this->openSections.back();
+
+	if (section >= 0) {
+		frame->cpuTimes[section] = glfwGetTime() - this->sectionStarts.back();
+		glQueryCounter(frame->queries[2 * section + 1], GL_TIMESTAMP);
+	}
+
+	this->openSections.pop_back();
+	this->sectionStarts.pop_back();
+}
+
+// sections left open are closed, so every query of the frame is issued
+void GPUTimer::endFrame() {
+	while (!this->openSections.empty()) {
+		this->end();
+	}
+
+	this->frames[this->current].issued = true;
+	this->frames[this->current].number = this->frameCount;
+	this->current = (this->current + 1) % GPU_TIMER_FRAMES;
+	this->frameCount++;
+}
+
+std::vector<gpuTiming_t> GPUTimer::getTimings() {
+	return(this->timings);
+}
+
+double GPUTimer::getTime(std::string name, bool gpu) {
+	for (int i = 0; i < this->timings.size(); i++) {
+		if (this->timings[i].name == name) {
+			return(gpu ? this->timings[i].gpuTime : this->timings[i].cpuTime);
+		}
+	}
+
+	return(0.0);
+}
+
+int GPUTimer::getDroppedFrames() {
+	return(this->droppedFrames);
+}
+
+int GPUTimer::getFrameCount() {
+	return(this->frameCount);
+}
+
+int GPUTimer::getLastFrame() {
+	return(this->lastFrame);
+}
+
+std::vector<gpuTiming_t> GPUTimer::getLastTimings() {
+	return(this->lastTimings);
+}
+
+double GPUTimer::getLastFrameTime() {
+	return(this->lastFrameTime);
+}
+
+void GPUTimer::readFrame(gpuTimerFrame_t* frame) {
+	std::vector<gpuTiming_t> timings;
+	GLuint64 frameStart = 0;
+	GLuint64 frameEnd = 0;
+
+	this->lastTimings.clear();
+
+	for (int i = 0; i < frame->count; i++) {
+		GLuint64 start;
+		GLuint64 end;
+		glGetQueryObjectui64v(frame->queries[2 * i], GL_QUERY_RESULT, &start);
+		glGetQueryObjectui64v(frame->queries[2 * i + 1], GL_QUERY_RESULT, &end);
+
+		if (i == 0) {
+			frameStart = start;
+		}
+
+		frameEnd = std::max(frameEnd, end);
+
+		gpuTiming_t timing;
+		timing.name = frame->names[i];
+		timing.gpuTime = (end - start) / 1000000000.0;
+		timing.cpuTime = frame->cpuTimes[i];
+		timing.depth = frame->depths[i];
+		this->lastTimings.push_back(timing);
+
+		// the times are averaged with the ones of the same section in the previous frames, a section that was
+		// switched off starts again from its first measurement
+		for (int j = 0; j < this->timings.size(); j++) {
+			if (this->timings[j].name == timing.name) {
+				timing.gpuTime = this->timings[j].gpuTime + (timing.gpuTime - this->timings[j].gpuTime) * 0.1;
+				timing.cpuTime = this->timings[j].cpuTime + (timing.cpuTime - this->timings[j].cpuTime) * 0.1;
+				break;
+			}
+		}
+
+		timings.push_back(timing);
+	}
+
+	this->timings = timings;
+	this->lastFrame = frame->number;
+	this->lastFrameTime = (frameEnd - frameStart) / 1000000000.0;
+}
@@ -0,0 +1,81 @@
+#ifndef __GPUTIMER__
+#define __GPUTIMER__
+
+#include <string>
+#include <vector>
+
+// frames in flight: the results of a frame are read when its slot comes around again, so the driver has had this many
+// frames to finish it and reading never stalls
+#define GPU_TIMER_FRAMES 4
+// timed sections a frame can have, the nested ones included
+#define GPU_TIMER_SECTIONS 48
+
+// averaged time of a section (s), on the GPU and on the CPU that submitted it
+typedef struct {
+	std::string name;
+	double gpuTime;
+	double cpuTime;
+	// number of sections it's nested in, 0 for the render graph passes
+	int depth;
+} gpuTiming_t;
+
+// queries and CPU times of the sections of one frame
+typedef struct {
+	unsigned int queries[2 * GPU_TIMER_SECTIONS];
+	std::string names[GPU_TIMER_SECTIONS];
+	double cpuTimes[GPU_TIMER_SECTIONS];
+	int depths[GPU_TIMER_SECTIONS];
+	int count;
+	bool issued;
+	// number of the frame in the slot
+	int number;
+} gpuTimerFrame_t;
+
+// class timing sections of a frame on the GPU with timestamp queries around them, next to the CPU time spent
+// submitting them. The queries of the last GPU_TIMER_FRAMES frames are kept in a ring, a frame whose results still
+// aren't there when its slot is reused is dropped instead of waited for
+class GPUTimer {
+	public:
+		// constructor method, creates the queries
+		GPUTimer();
+
+		// method for reading the results of the frame that used this slot and starting a new one
+		void beginFrame();
+		// methods for timing a section (name), a section begun inside another one is timed as part of it too
+		void begin(std::string);
+		void end();
+		// method for moving to the next slot of the ring
+		void endFrame();
+
+		// averaged times of the sections of the last frame that was read, in the order they ran
+		std::vector<gpuTiming_t> getTimings();
+		// averaged GPU or CPU time (s) of a section, 0 if it didn't run in the last frame that was read
+		double getTime(std::string, bool);
+		// frames whose results weren't ready in time
+		int getDroppedFrames();
+		// frames timed so far, the number of the next frame
+		int getFrameCount();
+		// number of the last frame that was read, -1 if none was, with its times as measured (not averaged) and the
+		// GPU time from the start of its first section to the end of its last one (s)
+		int getLastFrame();
+		std::vector<gpuTiming_t> getLastTimings();
+		double getLastFrameTime();
+
+	private:
+		gpuTimerFrame_t frames[GPU_TIMER_FRAMES];
+		int current;
+		std::vector<gpuTiming_t> timings;
+		int droppedFrames;
+		int frameCount;
+		int lastFrame;
+		std::vector<gpuTiming_t> lastTimings;
+		double lastFrameTime;
+		// sections begun and not ended yet, the innermost last: their slot (-1 if the frame was full) and CPU start time
+		std::vector<int> openSections;
+		std::vector<double> sectionStarts;
+
+		// method for averaging the results of a frame into the timings
+		void readFrame(gpuTimerFrame_t*);
+};
+
+#endif
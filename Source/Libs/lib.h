@@ -1,11 +1,12 @@
-#include "GLFW/glfw3.h"
-#include "glad/glad.h"
-#include <string>
-#include <stdlib.h>
-#include "init.h"
-#include "renderer.h"
-#include "eventHandler.h"
-#include "ui.h"
-#include "imgui.h"
-#include "imgui_impl_glfw.h"
-#include "imgui_impl_opengl3.h"
+#include "GLFW/glfw3.h"
+#include "glad/glad.h"
+#include <string>
+#include <stdlib.h>
+#include "init.h"
+#include "renderer.h"
+#include "eventHandler.h"
+#include "ui.h"
+#include "benchmark.h"
+#include "imgui.h"
+#include "imgui_impl_glfw.h"
+#include "imgui_impl_opengl3.h"
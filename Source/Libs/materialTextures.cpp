@@ -0,0 +1,184 @@
+#include "materialTextures.h"
+#include "init.h"
+#include <stdio.h>
+#include <algorithm>
+
+// ARB_bindless_texture isn't part of the loader, its entry points are looked up when the driver has it
+typedef GLuint64 (APIENTRYP getTextureSamplerHandle_t)(GLuint, GLuint);
+typedef void (APIENTRYP makeTextureHandleResident_t)(GLuint64);
+
+static getTextureSamplerHandle_t getTextureSamplerHandle = NULL;
+static makeTextureHandleResident_t makeTextureHandleResident = NULL;
+
+// constructor method
+MaterialTextures::MaterialTextures() {
+	this->bindless = false;
+
+	if (glfwExtensionSupported("GL_ARB_bindless_texture")) {
+		getTextureSamplerHandle = (getTextureSamplerHandle_t)glfwGetProcAddress("glGetTextureSamplerHandleARB");
+		makeTextureHandleResident = (makeTextureHandleResident_t)glfwGetProcAddress("glMakeTextureHandleResidentARB");
+
+		this->bindless = getTextureSamplerHandle != NULL && makeTextureHandleResident != NULL;
+	}
+
+	// the arrays are allocated with glTexStorage3D (4.2) and filled with glCopyImageSubData (4.3)
+	this->arrayPacking = GLAD_GL_VERSION_4_3 || (glfwExtensionSupported("GL_ARB_texture_storage") && glfwExtensionSupported("GL_ARB_copy_image"));
+
+	printf("material textures: %s\n", this->bindless ? "bindless" : this->arrayPacking ? "texture arrays" : "no texture arrays (needs openGL 4.3 or ARB_copy_image), entity textures are drawn untextured");
+
+	this->materialBuffer = glState->createBuffer(MAX_MATERIALS * sizeof(material_t), NULL, GL_DYNAMIC_STORAGE_BIT);
+}
+
+int MaterialTextures::getMaterial(unsigned int texture) {
+	if (texture == 0) {
+		return(-1);
+	}
+
+	std::map<unsigned int, int>::iterator cached = this->textureMaterials.find(texture);
+
+	if (cached != this->textureMaterials.end()) {
+		return(cached->second);
+	}
+
+	// textures that can't be added are remembered too, so they aren't tried again every draw
+	int index = -1;
+	material_t material;
+	material.handle = 0;
+	material.array = -1;
+	material.layer = -1;
+
+	if (this->materials.size() >= MAX_MATERIALS) {
+		printf("material buffer full, texture %d is drawn untextured\n", texture);
+	}
+	else if (this->bindless) {
+		// the handle keeps the sampler the texture was given, and has to be resident before a shader uses it
+		material.handle = getTextureSamplerHandle(texture, glState->getTextureSampler(texture));
+		makeTextureHandleResident(material.handle);
+		index = this->materials.size();
+	}
+	else if (this->arrayPacking && this->addToArray(texture, &material)) {
+		index = this->materials.size();
+	}
+
+	if (index >= 0) {
+		this->materials.push_back(material);
+		glState->bufferSubData(this->materialBuffer, index * sizeof(material_t), sizeof(material_t), &material);
+	}
+
+	this->textureMaterials[texture] = index;
+
+	return(index);
+}
+
+void MaterialTextures::bind() {
+	glState->bindBufferBase(GL_SHADER_STORAGE_BUFFER, MATERIAL_BUFFER_BINDING, this->materialBuffer);
+
+	for (int i = 0; i < this->arrays.size(); i++) {
+		glState->activeTexture(GL_TEXTURE0 + MATERIAL_ARRAY_UNIT + i);
+		glState->bindTexture(GL_TEXTURE_2D_ARRAY, this->arrays[i].texture);
+	}
+
+	glState->activeTexture(GL_TEXTURE0);
+}
+
+bool MaterialTextures::isBindless() {
+	return(this->bindless);
+}
+
+int MaterialTextures::getMaterialCount() {
+	return(this->materials.size());
+}
+
+int MaterialTextures::getArrayCount() {
+	return(this->arrays.size());
+}
+
+bool MaterialTextures::addToArray(unsigned int texture, material_t* material) {
+	int width;
+	int height;
+
+	if (glState->hasDirectStateAccess()) {
+		glGetTextureLevelParameteriv(texture, 0, GL_TEXTURE_WIDTH, &width);
+		glGetTextureLevelParameteriv(texture, 0, GL_TEXTURE_HEIGHT, &height);
+	}
+	else {
+		glState->bindTexture(GL_TEXTURE_2D, texture);
+		glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+		glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+	}
+
+	int array = -1;
+
+	for (int i = 0; i < this->arrays.size(); i++) {
+		if (this->arrays[i].width == width && this->arrays[i].height == height) {
+			array = i;
+		}
+	}
+
+	if (array < 0) {
+		if (this->arrays.size() >= MATERIAL_ARRAYS) {
+			printf("no texture array left for a %dx%d texture, texture %d is drawn untextured\n", width, height, texture);
+			return(false);
+		}
+
+		materialArray_t newArray;
+		newArray.texture = 0;
+		newArray.width = width;
+		newArray.height = height;
+		newArray.levels = GLState::getMipLevels(width, height);
+		newArray.layers = 0;
+		newArray.capacity = 0;
+
+		this->arrays.push_back(newArray);
+		array = this->arrays.size() - 1;
+	}
+
+	materialArray_t* target = &this->arrays[array];
+
+	if (target->layers == target->capacity) {
+		this->growArray(target);
+	}
+
+	// the entity textures have the whole mipmap chain, so every level is copied as it is
+	for (int level = 0; level < target->levels; level++) {
+		glCopyImageSubData(texture, GL_TEXTURE_2D, level, 0, 0, 0,
+			target->texture, GL_TEXTURE_2D_ARRAY, level, 0, 0, target->layers,
+			std::max(width >> level, 1), std::max(height >> level, 1), 1);
+	}
+
+	material->array = array;
+	material->layer = target->layers;
+	target->layers++;
+
+	return(true);
+}
+
+void MaterialTextures::growArray(materialArray_t* array) {
+	int capacity = std::max(array->capacity * 2, MATERIAL_ARRAY_LAYERS);
+	unsigned int texture;
+
+	if (glState->hasDirectStateAccess()) {
+		glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &texture);
+		glTextureStorage3D(texture, array->levels, GL_RGB8, array->width, array->height, capacity);
+	}
+	else {
+		glGenTextures(1, &texture);
+		glState->bindTexture(GL_TEXTURE_2D_ARRAY, texture);
+		glTexStorage3D(GL_TEXTURE_2D_ARRAY, array->levels, GL_RGB8, array->width, array->height, capacity);
+	}
+
+	glState->setTextureSampler(texture, glState->getSampler(GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR, GL_REPEAT));
+
+	if (array->texture != 0) {
+		for (int level = 0; level < array->levels; level++) {
+			glCopyImageSubData(array->texture, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+				texture, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+				std::max(array->width >> level, 1), std::max(array->height >> level, 1), array->layers);
+		}
+
+		glState->deleteTextures(1, &array->texture);
+	}
+
+	array->texture = texture;
+	array->capacity = capacity;
+}
@@ -0,0 +1,68 @@
+#ifndef __MATERIALTEXTURES__
+#define __MATERIALTEXTURES__
+
+#include <vector>
+#include <map>
+#include <glad\glad.h>
+
+// shader storage binding point of the material buffer, and texture units of the texture arrays and of the environment
+// cubemap sampled by the reflective shaders (the shaders declare the same values in their layouts)
+#define MATERIAL_BUFFER_BINDING 3
+#define MATERIAL_ARRAY_UNIT 8
+#define MATERIAL_ARRAYS 4
+#define ENVIRONMENT_TEXTURE_UNIT 7
+
+#define MAX_MATERIALS 256
+// layers a texture array starts with, doubled every time it fills up
+#define MATERIAL_ARRAY_LAYERS 4
+
+// material as it's laid out in the material buffer (std430): a bindless handle, or the array and layer of the texture
+typedef struct {
+	GLuint64 handle;
+	int array;
+	int layer;
+} material_t;
+
+// texture array holding all the material textures of one size
+typedef struct {
+	unsigned int texture;
+	int width;
+	int height;
+	int levels;
+	int layers;
+	int capacity;
+} materialArray_t;
+
+// class giving every 2D entity texture an index in a material buffer, so that draws select their texture with an
+// index instead of binding it: with ARB_bindless_texture the buffer holds the texture handles, otherwise the textures
+// are copied into a texture array per size and the buffer holds the array and layer
+class MaterialTextures {
+	public:
+		// constructor method, creates the material buffer and checks for bindless textures
+		MaterialTextures();
+
+		// index of the material of a texture, added the first time it's asked for (-1 without a texture)
+		int getMaterial(unsigned int);
+		// method for binding the material buffer and the texture arrays, once for all the draws of a pass
+		void bind();
+
+		bool isBindless();
+		int getMaterialCount();
+		int getArrayCount();
+
+	private:
+		bool bindless;
+		// the driver can allocate and copy into texture arrays, without it and without bindless there are no materials
+		bool arrayPacking;
+		unsigned int materialBuffer;
+		std::vector<material_t> materials;
+		std::map<unsigned int, int> textureMaterials;
+		std::vector<materialArray_t> arrays;
+
+		// method for copying a texture in the array of its size, growing or creating the array (texture, material)
+		bool addToArray(unsigned int, material_t*);
+		// method for reallocating an array with more layers, keeping the ones it already has
+		void growArray(materialArray_t*);
+};
+
+#endif
@@ -0,0 +1,101 @@
+#include "meshPool.h"
+#include "init.h"
+#include <glad\glad.h>
+
+// constructor method
+MeshPool::MeshPool() {
+	this->available = GLAD_GL_VERSION_4_3 || glfwExtensionSupported("GL_ARB_shader_storage_buffer_object");
+	this->size = 0;
+	this->capacity = MESH_POOL_FLOATS;
+	this->buffer = glState->createBuffer(this->capacity * sizeof(float), NULL, GL_DYNAMIC_STORAGE_BIT);
+}
+
+meshOffsets_t MeshPool::getMesh(Entity* entity) {
+	std::map<Entity*, meshOffsets_t>::iterator cached = this->meshes.find(entity);
+
+	if (cached != this->meshes.end() && cached->second.vertexBuffer == entity->getVertexBuffer() &&
+		cached->second.texBuffer == entity->getTexBuffer()) {
+		return(cached->second);
+	}
+
+	// entities sharing their buffers also share their data in the pool
+	for (std::map<Entity*, meshOffsets_t>::iterator it = this->meshes.begin(); it != this->meshes.end(); it++) {
+		if (it->second.vertexBuffer == entity->getVertexBuffer() && it->second.texBuffer == entity->getTexBuffer()) {
+			this->meshes[entity] = it->second;
+			return(it->second);
+		}
+	}
+
+	// the space of a mesh that was loaded again isn't reused, models are rarely replaced
+	meshOffsets_t mesh;
+	mesh.vertices = this->append(entity->getVertices());
+	mesh.uvs = this->append(entity->getUVs());
+	mesh.normals = this->append(entity->getNormals());
+	mesh.vertexBuffer = entity->getVertexBuffer();
+	mesh.texBuffer = entity->getTexBuffer();
+
+	this->meshes[entity] = mesh;
+
+	return(mesh);
+}
+
+void MeshPool::bind() {
+	glState->bindBufferBase(GL_SHADER_STORAGE_BUFFER, MESH_BUFFER_BINDING, this->buffer);
+}
+
+int MeshPool::getMeshCount() {
+	return(this->meshes.size());
+}
+
+size_t MeshPool::getSize() {
+	return(this->size);
+}
+
+bool MeshPool::isAvailable() {
+	return(this->available);
+}
+
+size_t MeshPool::getCapacity() {
+	return(this->capacity);
+}
+
+int MeshPool::append(std::vector<float> data) {
+	int offset = this->size;
+
+	if (data.empty()) {
+		return(offset);
+	}
+
+	if (this->size + data.size() > this->capacity) {
+		this->grow(this->size + data.size());
+	}
+
+	glState->bufferSubData(this->buffer, this->size * sizeof(float), data.size() * sizeof(float), &data[0]);
+	this->size += data.size();
+
+	return(offset);
+}
+
+void MeshPool::grow(size_t floats) {
+	size_t capacity = this->capacity;
+
+	while (capacity < floats) {
+		capacity *= 2;
+	}
+
+	unsigned int buffer = glState->createBuffer(capacity * sizeof(float), NULL, GL_DYNAMIC_STORAGE_BIT);
+
+	if (glState->hasDirectStateAccess()) {
+		glCopyNamedBufferSubData(this->buffer, buffer, 0, 0, this->size * sizeof(float));
+	}
+	else {
+		glState->bindBuffer(GL_COPY_READ_BUFFER, this->buffer);
+		glState->bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, this->size * sizeof(float));
+	}
+
+	glState->deleteBuffers(1, &this->buffer);
+
+	this->buffer = buffer;
+	this->capacity = capacity;
+}
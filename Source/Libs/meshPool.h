@@ -0,0 +1,57 @@
+#ifndef __MESHPOOL__
+#define __MESHPOOL__
+
+#include <map>
+#include "entity.h"
+
+// shader storage binding point of the mesh buffer (the generated vertex pulling code declares the same value)
+#define MESH_BUFFER_BINDING 4
+// floats the mesh buffer starts with, doubled every time a mesh doesn't fit
+#define MESH_POOL_FLOATS (1 << 20)
+
+// where the data of a mesh starts in the mesh buffer, in floats: vertices and normals have 3 floats per vertex,
+// uvs have 2 (or 3 when they're colors)
+typedef struct {
+	int vertices;
+	int uvs;
+	int normals;
+	// buffers the data was copied from, a mesh that's loaded again gets new ones and is copied again
+	unsigned int vertexBuffer;
+	unsigned int texBuffer;
+} meshOffsets_t;
+
+// class keeping the vertex data of all the entities in a single shader storage buffer, for the vertex pulling path:
+// the vertex shaders fetch their inputs from it with gl_VertexID and the offsets of the mesh they draw, so no
+// attributes are set up for the draws
+class MeshPool {
+	public:
+		// constructor method
+		MeshPool();
+
+		// offsets of the data of an entity, copied to the buffer the first time it's asked for
+		meshOffsets_t getMesh(Entity*);
+		// method for binding the mesh buffer, once for all the draws of a pass
+		void bind();
+
+		// checks for shader storage buffers (GL 4.3 or ARB_shader_storage_buffer_object), without them the entities
+		// keep their attributes
+		bool isAvailable();
+		int getMeshCount();
+		// floats in use and allocated
+		size_t getSize();
+		size_t getCapacity();
+
+	private:
+		bool available;
+		unsigned int buffer;
+		size_t size;
+		size_t capacity;
+		std::map<Entity*, meshOffsets_t> meshes;
+
+		// method for appending data at the end of the buffer, returns its offset in floats
+		int append(std::vector<float>);
+		// method for reallocating the buffer to fit at least the given floats, keeping its data
+		void grow(size_t);
+};
+
+#endif
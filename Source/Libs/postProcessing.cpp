@@ -0,0 +1,626 @@
+#include "postProcessing.h"
+#include <glad\glad.h>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "init.h"
+
+// constructor method: registers the effects that used to be hard-coded in the screen shader, the targets are created
+// by the first resize
+PostProcessing::PostProcessing(unsigned int screenVBO, unsigned int screenUVVBO, GPUTimer* timer) {
+	this->screenVBO = screenVBO;
+	this->screenUVVBO = screenUVVBO;
+
+	this->targetFBO[0] = 0;
+	this->targetFBO[1] = 0;
+	this->targetTexture[0] = 0;
+	this->targetTexture[1] = 0;
+	this->targetWidth = 0;
+	this->targetHeight = 0;
+
+	this->timer = timer;
+	this->timedFrame = -1;
+
+	for (int i = 0; i < GPU_TIMER_FRAMES; i++) {
+		this->frameCompute[i] = false;
+	}
+
+	this->frameCount = 0;
+
+	this->blurShader = new Shader((char*)"blur shader");
+	this->blurShader->loadShader((char*)"../Shader/postProcessing/postProcessing.vert", (char*)"../Shader/postProcessing/blur.frag");
+
+	this->convolutionShader = new Shader((char*)"convolution shader");
+	this->convolutionShader->loadShader((char*)"../Shader/postProcessing/postProcessing.vert", (char*)"../Shader/postProcessing/convolution.frag");
+
+	// the neighbourhood effects can also run as compute shaders working on shared memory tiles
+	this->computeAvailable = GLAD_GL_VERSION_4_3 != 0;
+	this->computeBlurShader = NULL;
+	this->computeConvolutionShader = NULL;
+
+	if (this->computeAvailable) {
+		this->computeBlurShader = new Shader((char*)"compute blur shader");
+		this->computeBlurShader->loadComputeShader((char*)"../Shader/postProcessing/compute/blur.comp");
+
+		this->computeConvolutionShader = new Shader((char*)"compute convolution shader");
+		this->computeConvolutionShader->loadComputeShader((char*)"../Shader/postProcessing/compute/convolution.comp");
+	}
+
+	int stage;
+
+	stage = this->addStage("Barrel Distortion", "barrelDistortion", (char*)"../Shader/postProcessing/stages/barrelDistortion.glsl", warpStage);
+	this->addParameter(stage, "Power", 1.5f, 1.0f, 3.0f);
+
+	stage = this->addStage("Fish Eye", "fishEye", (char*)"../Shader/postProcessing/stages/fishEye.glsl", warpStage);
+	this->addParameter(stage, "Aperture", 178.0f, 90.0f, 180.0f);
+
+	stage = this->addKernelStage("Gaussian Blur", blurStage, std::vector<float>());
+	this->addParameter(stage, "Sigma", 1.0f, 0.5f, 8.0f);
+
+	float sharpen[9] = { 0, -1, 0, -1, 5, -1, 0, -1, 0 };
+	stage = this->addKernelStage("Sharpen", convolutionStage, std::vector<float>(sharpen, sharpen + 9));
+	this->addParameter(stage, "Strength", 0.5f, 0.0f, 2.0f);
+
+	float edges[9] = { 1, 1, 1, 1, -8, 1, 1, 1, 1 };
+	stage = this->addKernelStage("Edge Detection", convolutionStage, std::vector<float>(edges, edges + 9));
+	this->addParameter(stage, "Strength", 1.0f, 0.0f, 1.0f);
+
+	stage = this->addStage("Invert", "invert", (char*)"../Shader/postProcessing/stages/invert.glsl", pixelStage);
+
+	stage = this->addStage("Color Filter", "colorFilter", (char*)"../Shader/postProcessing/stages/colorFilter.glsl", pixelStage);
+	this->addParameter(stage, "Red", 0.8f, 0.0f, 1.0f);
+	this->addParameter(stage, "Green", 0.8f, 0.0f, 1.0f);
+	this->addParameter(stage, "Blue", 0.8f, 0.0f, 1.0f);
+
+	stage = this->addStage("Vignette", "vignette", (char*)"../Shader/postProcessing/stages/vignette.glsl", pixelStage);
+	this->addParameter(stage, "Strength", 1.0f, 0.0f, 2.0f);
+}
+
+int PostProcessing::addStage(std::string name, std::string function, char* file, stageType_t type) {
+	postProcessingStage_t stage;
+
+	stage.name = name;
+	stage.function = function;
+	stage.type = type;
+	stage.enabled = false;
+	stage.parameterCount = 0;
+
+	for (int i = 0; i < 4; i++) {
+		stage.parameterNames[i] = NULL;
+		stage.parameters[i] = 0.0f;
+		stage.minimum[i] = 0.0f;
+		stage.maximum[i] = 1.0f;
+		stage.kernelParameters[i] = -1.0f;
+	}
+
+	// the function is pasted into the fused shaders, so it's read only once
+	std::ifstream stream(file, std::ios::in);
+
+	if (stream.is_open()) {
+		std::stringstream sstr;
+		sstr << stream.rdbuf();
+		stage.code = sstr.str();
+		stream.close();
+	}
+	else {
+		printf("Impossible to open %s\n", file);
+	}
+
+	this->stages.push_back(stage);
+	this->order.push_back(this->stages.size() - 1);
+
+	return(this->stages.size() - 1);
+}
+
+int PostProcessing::addKernelStage(std::string name, stageType_t type, std::vector<float> kernel) {
+	int index = this->addStage(name, "", (char*)"", type);
+
+	this->stages[index].code = "";
+	this->stages[index].baseKernel = kernel;
+
+	return(index);
+}
+
+void PostProcessing::addParameter(int index, const char* name, float value, float minimum, float maximum) {
+	postProcessingStage_t* stage = &this->stages[index];
+
+	if (stage->parameterCount >= 4) {
+		return;
+	}
+
+	stage->parameterNames[stage->parameterCount] = name;
+	stage->parameters[stage->parameterCount] = value;
+	stage->minimum[stage->parameterCount] = minimum;
+	stage->maximum[stage->parameterCount] = maximum;
+	stage->parameterCount++;
+}
+
+void PostProcessing::moveStage(int position, int direction) {
+	int target = position + direction;
+
+	if (target < 0 || target >= this->order.size()) {
+		return;
+	}
+
+	std::swap(this->order[position], this->order[target]);
+}
+
+bool PostProcessing::isComputeAvailable() {
+	return(this->computeAvailable);
+}
+
+bool PostProcessing::isActive() {
+	for (int i = 0; i < this->stages.size(); i++) {
+		if (this->stages[i].enabled) {
+			return(true);
+		}
+	}
+
+	return(false);
+}
+
+unsigned int PostProcessing::getInputFBO() {
+	return(this->targetFBO[0]);
+}
+
+unsigned int PostProcessing::getInputTexture() {
+	return(this->targetTexture[0]);
+}
+
+int PostProcessing::getTargetWidth() {
+	return(this->targetWidth);
+}
+
+int PostProcessing::getTargetHeight() {
+	return(this->targetHeight);
+}
+
+std::vector<postProcessingStage_t>* PostProcessing::getStages() {
+	return(&this->stages);
+}
+
+std::vector<int>* PostProcessing::getOrder() {
+	return(&this->order);
+}
+
+std::vector<postProcessingPass_t>* PostProcessing::getPasses() {
+	return(&this->passes);
+}
+
+void PostProcessing::render(unsigned int source, float uvScaleX, float uvScaleY, float uvMaxX, float uvMaxY) {
+	// the passes only change when a stage is enabled, disabled or moved
+	std::string currentSignature;
+
+	for (int i = 0; i < this->order.size(); i++) {
+		if (this->stages[this->order[i]].enabled) {
+			currentSignature += std::to_string(this->order[i]) + ",";
+		}
+	}
+
+	if (currentSignature != this->signature) {
+		this->signature = currentSignature;
+		this->buildPasses();
+	}
+
+	this->readTimers();
+
+	// the last pass draws where the chain was asked to
+	int outputFBO;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &outputFBO);
+
+	unsigned int input = source;
+	int write = (source == this->targetTexture[0]) ? 1 : 0;
+
+	// while benchmarking the paths take turns every frame, so both are timed on the same image
+	bool compute = this->computeAvailable && (postProcessingBenchmark ? this->frameCount % 2 == 1 : computePostProcessing);
+	this->frameCount++;
+
+	int slot = this->timer->getFrameCount() % GPU_TIMER_FRAMES;
+	this->frameSignatures[slot] = this->signature;
+	this->frameCompute[slot] = compute;
+
+	glState->activeTexture(GL_TEXTURE0);
+
+	for (int i = 0; i < this->passes.size(); i++) {
+		postProcessingPass_t* pass = &this->passes[i];
+		postProcessingStage_t* first = &this->stages[pass->stages[0]];
+		bool computePass = compute && pass->computeShader != NULL;
+		unsigned int program = computePass ? pass->computeShader->getID() : pass->shader->getID();
+
+		this->timer->begin(getSectionName(i));
+
+		// compute passes always write to a ping-pong target, at the end of the chain it's copied to the output
+		if (!computePass) {
+			if (i == this->passes.size() - 1) {
+				glState->bindFramebuffer(GL_FRAMEBUFFER, outputFBO);
+			}
+			else {
+				glState->bindFramebuffer(GL_FRAMEBUFFER, this->targetFBO[write]);
+			}
+		}
+
+		glState->useProgram(program);
+		glState->bindTexture(GL_TEXTURE_2D, input);
+
+		glState->uniform1i(glState->getUniformLocation(program, "screenTexture"), 0);
+		glState->uniform2f(glState->getUniformLocation(program, "uvScale"), uvScaleX, uvScaleY);
+		glState->uniform2f(glState->getUniformLocation(program, "uvMax"), uvMaxX, uvMaxY);
+
+		if (computePass) {
+			glState->uniform2i(glState->getUniformLocation(program, "outputSize"), screenWidth, screenHeight);
+		}
+
+		if (first->type == blurStage && computePass) {
+			this->updateKernel(pass->stages[0]);
+
+			glState->uniform1i(glState->getUniformLocation(program, "vertical"), pass->vertical ? 1 : 0);
+			glState->uniform1i(glState->getUniformLocation(program, "radius"), first->gaussian.size() - 1);
+			glState->uniform1fv(glState->getUniformLocation(program, "weights"), first->gaussian.size(), &first->gaussian[0]);
+		}
+		else if (first->type == blurStage) {
+			this->updateKernel(pass->stages[0]);
+
+			if (pass->vertical) {
+				glState->uniform2f(glState->getUniformLocation(program, "direction"), 0.0f, 1.0f / this->targetHeight);
+			}
+			else {
+				glState->uniform2f(glState->getUniformLocation(program, "direction"), 1.0f / this->targetWidth, 0.0f);
+			}
+
+			glState->uniform1i(glState->getUniformLocation(program, "taps"), first->weights.size());
+			glState->uniform1fv(glState->getUniformLocation(program, "weights"), first->weights.size(), &first->weights[0]);
+			glState->uniform1fv(glState->getUniformLocation(program, "offsets"), first->offsets.size(), &first->offsets[0]);
+		}
+		else if (first->type == convolutionStage) {
+			this->updateKernel(pass->stages[0]);
+
+			glState->uniform2f(glState->getUniformLocation(program, "texelSize"), 1.0f / this->targetWidth, 1.0f / this->targetHeight);
+			glState->uniform1fv(glState->getUniformLocation(program, "kernel"), 9, &first->weights[0]);
+		}
+		else {
+			// every fused stage has its own parameters uniform
+			for (int j = 0; j < pass->stages.size(); j++) {
+				postProcessingStage_t* stage = &this->stages[pass->stages[j]];
+				glState->uniform4fv(glState->getUniformLocation(program, (stage->function + "Parameters").c_str()), 1, stage->parameters);
+			}
+		}
+
+		if (computePass) {
+			this->dispatchCompute(pass, this->targetTexture[write]);
+
+			if (i == this->passes.size() - 1) {
+				glState->bindFramebuffer(GL_READ_FRAMEBUFFER, this->targetFBO[write]);
+				glState->bindFramebuffer(GL_DRAW_FRAMEBUFFER, outputFBO);
+				glBlitFramebuffer(0, 0, screenWidth, screenHeight, 0, 0, screenWidth, screenHeight, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+				glState->bindFramebuffer(GL_FRAMEBUFFER, outputFBO);
+			}
+		}
+		else {
+			this->drawScreenQuad();
+		}
+
+		this->timer->end();
+
+		// from now on the input is the screen sized corner of a ping-pong target
+		input = this->targetTexture[write];
+		write = 1 - write;
+		uvScaleX = (float)screenWidth / this->targetWidth;
+		uvScaleY = (float)screenHeight / this->targetHeight;
+		uvMaxX = (screenWidth - 0.5f) / this->targetWidth;
+		uvMaxY = (screenHeight - 0.5f) / this->targetHeight;
+	}
+}
+
+// split the enabled stages into passes: consecutive pixel stages (and the warp stage leading them) share a generated
+// shader, blurs get a horizontal and a vertical pass and convolutions a pass of their own
+void PostProcessing::buildPasses() {
+	this->passes.clear();
+
+	postProcessingPass_t fused;
+	fused.shader = NULL;
+	fused.computeShader = NULL;
+	fused.vertical = false;
+	fused.gpuTime = 0.0;
+	fused.computeTime = 0.0;
+
+	for (int i = 0; i < this->order.size(); i++) {
+		int index = this->order[i];
+		postProcessingStage_t* stage = &this->stages[index];
+
+		if (!stage->enabled) {
+			continue;
+		}
+
+		// a pixel stage joins the open fused pass, everything else closes it
+		if (stage->type == pixelStage && !fused.stages.empty()) {
+			fused.stages.push_back(index);
+			continue;
+		}
+
+		if (!fused.stages.empty()) {
+			this->passes.push_back(fused);
+			fused.stages.clear();
+		}
+
+		if (stage->type == pixelStage || stage->type == warpStage) {
+			fused.stages.push_back(index);
+		}
+
+		else if (stage->type == blurStage) {
+			postProcessingPass_t pass;
+			pass.stages.push_back(index);
+			pass.shader = this->blurShader;
+			pass.computeShader = this->computeBlurShader;
+			pass.gpuTime = 0.0;
+			pass.computeTime = 0.0;
+
+			pass.vertical = false;
+			pass.label = stage->name + " (horizontal)";
+			this->passes.push_back(pass);
+
+			pass.vertical = true;
+			pass.label = stage->name + " (vertical)";
+			this->passes.push_back(pass);
+		}
+
+		else if (stage->type == convolutionStage) {
+			postProcessingPass_t pass;
+			pass.stages.push_back(index);
+			pass.shader = this->convolutionShader;
+			pass.computeShader = this->computeConvolutionShader;
+			pass.vertical = false;
+			pass.label = stage->name;
+			pass.gpuTime = 0.0;
+			pass.computeTime = 0.0;
+			this->passes.push_back(pass);
+		}
+	}
+
+	if (!fused.stages.empty()) {
+		this->passes.push_back(fused);
+	}
+
+	if (this->passes.size() > MAX_POST_PROCESSING_PASSES) {
+		printf("post processing: too many passes, only the first %d are drawn\n", MAX_POST_PROCESSING_PASSES);
+		this->passes.resize(MAX_POST_PROCESSING_PASSES);
+	}
+
+	for (int i = 0; i < this->passes.size(); i++) {
+		if (this->passes[i].shader == NULL) {
+			this->passes[i].shader = this->getFusedShader(this->passes[i].stages);
+
+			for (int j = 0; j < this->passes[i].stages.size(); j++) {
+				if (j > 0) {
+					this->passes[i].label += " + ";
+				}
+
+				this->passes[i].label += this->stages[this->passes[i].stages[j]].name;
+			}
+		}
+	}
+}
+
+// shader running a list of pixel stages (optionally led by a warp stage) in a single pass, compiled the first time
+// that list is used
+Shader* PostProcessing::getFusedShader(std::vector<int> stageList) {
+	std::string key;
+
+	for (int i = 0; i < stageList.size(); i++) {
+		key += this->stages[stageList[i]].function + ",";
+	}
+
+	std::map<std::string, Shader*>::iterator cached = this->fusedShaders.find(key);
+
+	if (cached != this->fusedShaders.end()) {
+		return(cached->second);
+	}
+
+	std::string code =
+		"#version 330 core\n"
+		"\n"
+		"out vec4 FragColor;\n"
+		"\n"
+		"in vec2 TexCoords;\n"
+		"\n"
+		"uniform sampler2D screenTexture;\n"
+		"uniform vec2 uvScale;\n"
+		"uniform vec2 uvMax;\n"
+		"\n"
+		"const float PI = 3.1415926535;\n"
+		"\n";
+
+	for (int i = 0; i < stageList.size(); i++) {
+		postProcessingStage_t* stage = &this->stages[stageList[i]];
+		code += "uniform vec4 " + stage->function + "Parameters;\n\n";
+		code += stage->code + "\n";
+	}
+
+	code +=
+		"void main() {\n"
+		"    // screen uv of the pixel, the input may only cover part of screenTexture\n"
+		"    vec2 uv = TexCoords / uvScale;\n"
+		"    vec2 sampleCoord = uv;\n";
+
+	int first = 0;
+
+	if (this->stages[stageList[0]].type == warpStage) {
+		code += "    sampleCoord = " + this->stages[stageList[0]].function + "(sampleCoord, " + this->stages[stageList[0]].function + "Parameters);\n";
+		first = 1;
+	}
+
+	code += "    vec3 color = texture(screenTexture, min(sampleCoord * uvScale, uvMax)).rgb;\n";
+
+	for (int i = first; i < stageList.size(); i++) {
+		std::string function = this->stages[stageList[i]].function;
+		code += "    color = " + function + "(color, uv, " + function + "Parameters);\n";
+	}
+
+	code +=
+		"    FragColor = vec4(color, 1.0);\n"
+		"}\n";
+
+	// the shader keeps a pointer to its name
+	std::string name = "post processing (" + key + ")";
+	char* shaderName = (char*)calloc(name.size() + 1, sizeof(char));
+	strcpy(shaderName, name.c_str());
+
+	Shader* shader = new Shader(shaderName);
+	shader->loadShader((char*)"../Shader/postProcessing/postProcessing.vert", code);
+
+	this->fusedShaders[key] = shader;
+
+	return(shader);
+}
+
+// rebuild the kernel of a blur or convolution stage if its parameters changed since the last time
+void PostProcessing::updateKernel(int index) {
+	postProcessingStage_t* stage = &this->stages[index];
+
+	if (memcmp(stage->parameters, stage->kernelParameters, sizeof(stage->parameters)) == 0) {
+		return;
+	}
+
+	memcpy(stage->kernelParameters, stage->parameters, sizeof(stage->parameters));
+
+	stage->weights.clear();
+	stage->offsets.clear();
+	stage->gaussian.clear();
+
+	if (stage->type == blurStage) {
+		float sigma = std::max(stage->parameters[0], 0.1f);
+		// 3 sigma cover almost all of the curve, the taps are limited by the size of the uniform arrays
+		int radius = std::min((int)ceil(3.0f * sigma), MAX_BLUR_RADIUS);
+
+		std::vector<float> gaussian;
+		float total = 0.0f;
+
+		for (int i = 0; i <= radius; i++) {
+			gaussian.push_back(exp(-(float)(i * i) / (2.0f * sigma * sigma)));
+			total += (i == 0) ? gaussian[i] : 2.0f * gaussian[i];
+		}
+
+		for (int i = 0; i <= radius; i++) {
+			gaussian[i] /= total;
+		}
+
+		stage->gaussian = gaussian;
+
+		// two neighbouring texels are read with one bilinear tap placed between them by their weights
+		stage->weights.push_back(gaussian[0]);
+		stage->offsets.push_back(0.0f);
+
+		for (int i = 1; i <= radius; i += 2) {
+			float weightA = gaussian[i];
+			float weightB = (i + 1 <= radius) ? gaussian[i + 1] : 0.0f;
+
+			stage->weights.push_back(weightA + weightB);
+			stage->offsets.push_back((i * weightA + (i + 1) * weightB) / (weightA + weightB));
+		}
+	}
+
+	else if (stage->type == convolutionStage) {
+		// the strength blends between leaving the image as it is and the full kernel
+		for (int i = 0; i < 9; i++) {
+			float identity = (i == 4) ? 1.0f : 0.0f;
+			stage->weights.push_back(identity + (stage->baseKernel[i] - identity) * stage->parameters[0]);
+		}
+	}
+}
+
+// take the pass timings of the last frame the timer read, if the chain didn't change since then
+void PostProcessing::readTimers() {
+	int frame = this->timer->getLastFrame();
+
+	if (frame < 0 || frame == this->timedFrame) {
+		return;
+	}
+
+	this->timedFrame = frame;
+
+	int slot = frame % GPU_TIMER_FRAMES;
+
+	if (this->frameSignatures[slot] != this->signature) {
+		return;
+	}
+
+	std::vector<gpuTiming_t> timings = this->timer->getLastTimings();
+
+	for (int i = 0; i < this->passes.size(); i++) {
+		std::string name = getSectionName(i);
+
+		for (int j = 0; j < timings.size(); j++) {
+			if (timings[j].name != name) {
+				continue;
+			}
+
+			if (this->frameCompute[slot]) {
+				this->passes[i].computeTime = timings[j].gpuTime;
+			}
+			else {
+				this->passes[i].gpuTime = timings[j].gpuTime;
+			}
+		}
+	}
+}
+
+std::string PostProcessing::getSectionName(int pass) {
+	return("Post Processing " + std::to_string(pass + 1));
+}
+
+// the targets can be bigger than the screen (see Renderer::updateTargetSize), the chain only uses their bottom left corner
+void PostProcessing::resize(int width, int height) {
+	this->targetWidth = width;
+	this->targetHeight = height;
+
+	glState->deleteTextures(2, this->targetTexture);
+	glState->deleteFramebuffers(2, this->targetFBO);
+
+	for (int i = 0; i < 2; i++) {
+		// rgba, since the compute path writes them as images
+		this->targetTexture[i] = glState->createTexture(GL_TEXTURE_2D, GL_RGBA8, width, height, 1, 0);
+		// linear filtering is needed by the merged taps of the blur
+		glState->setTextureSampler(this->targetTexture[i], glState->getSampler(GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE));
+
+		this->targetFBO[i] = glState->createFramebuffer();
+		glState->framebufferTexture(this->targetFBO[i], GL_COLOR_ATTACHMENT0, this->targetTexture[i], 0, -1);
+	}
+}
+
+// run the compute version of a pass over the whole screen, writing to the given target
+void PostProcessing::dispatchCompute(postProcessingPass_t* pass, unsigned int target) {
+	glBindImageTexture(0, target, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+
+	// blurs work on runs of 128 pixels of a row or column, convolutions on 16x16 tiles
+	if (this->stages[pass->stages[0]].type == blurStage) {
+		if (pass->vertical) {
+			glDispatchCompute((screenHeight + 127) / 128, screenWidth, 1);
+		}
+		else {
+			glDispatchCompute((screenWidth + 127) / 128, screenHeight, 1);
+		}
+	}
+	else {
+		glDispatchCompute((screenWidth + 15) / 16, (screenHeight + 15) / 16, 1);
+	}
+
+	// the next pass samples the result, the copy at the end of the chain reads it through a framebuffer
+	glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_FRAMEBUFFER_BARRIER_BIT);
+}
+
+void PostProcessing::drawScreenQuad() {
+	glEnableVertexAttribArray(0);
+	glState->bindBuffer(GL_ARRAY_BUFFER, this->screenVBO);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+	glEnableVertexAttribArray(1);
+	glState->bindBuffer(GL_ARRAY_BUFFER, this->screenUVVBO);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+	glDrawArrays(GL_TRIANGLES, 0, 6);
+
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+}
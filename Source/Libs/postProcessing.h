@@ -0,0 +1,148 @@
+#ifndef __POSTPROCESSING__
+#define __POSTPROCESSING__
+
+#include <vector>
+#include <map>
+#include <string>
+#include "shader.h"
+#include "gpuTimer.h"
+// most passes a chain can be split into
+#define MAX_POST_PROCESSING_PASSES 16
+// most taps (center included) of a separable blur, has to match blur.frag
+#define MAX_BLUR_TAPS 17
+// widest blur radius in texels, has to match compute/blur.comp
+#define MAX_BLUR_RADIUS (2 * (MAX_BLUR_TAPS - 1))
+
+typedef enum {
+	// changes the color of a pixel using only that pixel, any number of them is fused into a single pass
+	pixelStage,
+	// moves the coordinate the input is read at, starts a new fused pass
+	warpStage,
+	// gaussian blur, split into a horizontal and a vertical pass
+	blurStage,
+	// 3x3 kernel, in its own pass
+	convolutionStage
+} stageType_t;
+
+// struct for saving the informations about a post processing effect
+typedef struct {
+	std::string name;
+	// name of the glsl function of pixel and warp stages
+	std::string function;
+	// code of the glsl function of pixel and warp stages
+	std::string code;
+	stageType_t type;
+	bool enabled;
+
+	// parameters of the effect, passed to the glsl function (vec4) or used to build the kernel
+	int parameterCount;
+	const char* parameterNames[4];
+	float parameters[4];
+	float minimum[4];
+	float maximum[4];
+
+	// kernel of blur and convolution stages, rebuilt only when the parameters change
+	std::vector<float> baseKernel;
+	std::vector<float> weights;
+	std::vector<float> offsets;
+	// unmerged weights of the blur, one per texel from the center (compute path)
+	std::vector<float> gaussian;
+	float kernelParameters[4];
+} postProcessingStage_t;
+
+// struct for saving a single draw of the chain
+typedef struct {
+	// stages drawn by this pass, more than one when they are fused
+	std::vector<int> stages;
+	Shader* shader;
+	// compute version of the pass, NULL for the passes that don't read their neighbourhood
+	Shader* computeShader;
+	// horizontal or vertical half of a blur
+	bool vertical;
+	// label shown in the ui
+	std::string label;
+	// last time measured with the fragment and with the compute path
+	double gpuTime;
+	double computeTime;
+} postProcessingPass_t;
+
+// class for the chain of post processing effects applied to the image before it's shown
+class PostProcessing {
+	public:
+		// constructor method, takes the buffers of the square covering the screen and the timer the passes are timed with
+		PostProcessing(unsigned int, unsigned int, GPUTimer*);
+
+		// method for registering a pixel or warp stage (name, glsl function, file with the function)
+		int addStage(std::string, std::string, char*, stageType_t);
+		// method for registering a blur or convolution stage, convolutions take their full strength 3x3 kernel
+		int addKernelStage(std::string, stageType_t, std::vector<float>);
+		// method for setting the parameters of a stage (index, name, default, minimum, maximum)
+		void addParameter(int, const char*, float, float, float);
+
+		// method for drawing the chain: source texture, the part of it that's used (uv scale, last uv),
+		// the last pass draws to the currently bound framebuffer
+		void render(unsigned int, float, float, float, float);
+		// method for (re)creating the ping-pong targets (width, height)
+		void resize(int, int);
+		// method for moving a stage up (-1) or down (1) in the chain
+		void moveStage(int, int);
+
+		// checks if at least one stage is enabled
+		bool isActive();
+		// checks if the compute path can be used (openGL 4.3)
+		bool isComputeAvailable();
+		// target that can be used to feed the chain, so that a pass can be drawn before it
+		unsigned int getInputFBO();
+		unsigned int getInputTexture();
+		int getTargetWidth();
+		int getTargetHeight();
+
+		std::vector<postProcessingStage_t>* getStages();
+		std::vector<int>* getOrder();
+		std::vector<postProcessingPass_t>* getPasses();
+
+	private:
+		unsigned int screenVBO;
+		unsigned int screenUVVBO;
+
+		std::vector<postProcessingStage_t> stages;
+		// order of the stages in the chain
+		std::vector<int> order;
+		std::vector<postProcessingPass_t> passes;
+		// enabled stages in order, the passes are rebuilt when it changes
+		std::string signature;
+
+		// fused shaders already compiled, by the list of the stages they contain
+		std::map<std::string, Shader*> fusedShaders;
+		Shader* blurShader;
+		Shader* convolutionShader;
+		Shader* computeBlurShader;
+		Shader* computeConvolutionShader;
+		bool computeAvailable;
+		// frames drawn, the benchmark switches path every frame
+		int frameCount;
+
+		// ping-pong targets, every pass reads the output of the one before
+		unsigned int targetFBO[2];
+		unsigned int targetTexture[2];
+		int targetWidth;
+		int targetHeight;
+
+		// the passes are timed as sections nested in the render graph pass that draws the chain, with the chain and the
+		// path of every frame in the timer ring (by frame number), and the last frame whose times were taken
+		GPUTimer* timer;
+		std::string frameSignatures[GPU_TIMER_FRAMES];
+		bool frameCompute[GPU_TIMER_FRAMES];
+		int timedFrame;
+
+		void buildPasses();
+		Shader* getFusedShader(std::vector<int>);
+		void updateKernel(int);
+		void readTimers();
+		// name of the timer section of a pass (index)
+		static std::string getSectionName(int);
+		void dispatchCompute(postProcessingPass_t*, unsigned int);
+		void drawScreenQuad();
+};
+
+#endif
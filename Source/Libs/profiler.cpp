@@ -0,0 +1,294 @@
+#include "profiler.h"
+#include "init.h"
+#include <stdio.h>
+#include <chrono>
+#include <fstream>
+#include <set>
+
+// zones recorded to measure the cost of a zone
+#define PROFILER_CALIBRATION_ZONES 1000
+
+static const std::chrono::steady_clock::time_point profilerStart = std::chrono::steady_clock::now();
+// zones of the calling thread, so recording a zone never takes a lock after the first one
+static thread_local profileThread_t* currentThread = NULL;
+
+// constructor method
+Profiler::Profiler() {
+	this->enabled = true;
+	this->frameStart = 0;
+	this->frameDuration = 0;
+	this->zoneCost = 0.0;
+	this->lostEvents = 0;
+	this->captureFrames = 0;
+}
+
+bool Profiler::beginZone(const char* name) {
+	if (!this->enabled) {
+		return(false);
+	}
+
+	profileThread_t* thread = this->getThread();
+
+	if (thread->depth >= PROFILER_MAX_DEPTH) {
+		return(false);
+	}
+
+	profileEvent_t* event = &thread->events[thread->written % PROFILER_THREAD_EVENTS];
+	event->name = name;
+	event->depth = thread->depth;
+	event->thread = thread->id;
+	event->start = now();
+	event->end = event->start;
+
+	thread->stack[thread->depth] = thread->written;
+	thread->depth++;
+	thread->written++;
+
+	return(true);
+}
+
+void Profiler::endZone() {
+	profileThread_t* thread = this->getThread();
+
+	thread->depth--;
+	thread->events[thread->stack[thread->depth] % PROFILER_THREAD_EVENTS].end = now();
+
+	// the zones are only handed to the collecting thread once the outermost one closed, so it never reads a zone
+	// that's still open
+	if (thread->depth == 0) {
+		thread->committed.store(thread->written, std::memory_order_release);
+	}
+}
+
+void Profiler::endFrame() {
+#if PROFILER
+	long long end = now();
+
+	if (this->zoneCost == 0.0 && this->enabled) {
+		this->calibrate();
+	}
+
+	this->frameEvents.clear();
+
+	{
+		std::lock_guard<std::mutex> lock(this->threadsMutex);
+
+		for (int i = 0; i < this->threads.size(); i++) {
+			profileThread_t* thread = this->threads[i];
+			unsigned long long committed = thread->committed.load(std::memory_order_acquire);
+
+			if (committed - thread->read > PROFILER_THREAD_EVENTS) {
+				this->lostEvents += committed - thread->read - PROFILER_THREAD_EVENTS;
+				thread->read = committed - PROFILER_THREAD_EVENTS;
+			}
+
+			for (; thread->read < committed; thread->read++) {
+				this->frameEvents.push_back(thread->events[thread->read % PROFILER_THREAD_EVENTS]);
+			}
+		}
+	}
+
+	this->frameDuration = end - this->frameStart;
+	this->frameStart = end;
+
+	if (this->captureFrames > 0) {
+		this->captureEvents.insert(this->captureEvents.end(), this->frameEvents.begin(), this->frameEvents.end());
+		this->captureFrames--;
+
+		if (this->captureFrames == 0) {
+			this->writeTrace();
+		}
+	}
+#endif
+}
+
+void Profiler::setThreadName(std::string name) {
+	profileThread_t* thread = this->getThread();
+
+	std::lock_guard<std::mutex> lock(this->threadsMutex);
+	thread->name = name;
+}
+
+void Profiler::captureTrace() {
+	if (this->captureFrames > 0) {
+		return;
+	}
+
+	this->captureEvents.clear();
+	this->captureFrames = PROFILER_CAPTURE_FRAMES;
+}
+
+void Profiler::setEnabled(bool enabled) {
+	this->enabled = enabled;
+}
+
+bool Profiler::isEnabled() {
+	return(this->enabled);
+}
+
+bool Profiler::isCapturing() {
+	return(this->captureFrames > 0);
+}
+
+std::vector<profileEvent_t> Profiler::getFrameEvents() {
+	return(this->frameEvents);
+}
+
+long long Profiler::getFrameStart() {
+	return(this->frameStart - this->frameDuration);
+}
+
+long long Profiler::getFrameDuration() {
+	return(this->frameDuration);
+}
+
+double Profiler::getZoneCost() {
+	return(this->zoneCost);
+}
+
+double Profiler::getOverhead() {
+	if (this->frameDuration <= 0) {
+		return(0.0);
+	}
+
+	return(this->frameEvents.size() * this->zoneCost / this->frameDuration * 100.0);
+}
+
+int Profiler::getLostEvents() {
+	return(this->lostEvents);
+}
+
+std::string Profiler::getThreadName(int id) {
+	std::lock_guard<std::mutex> lock(this->threadsMutex);
+
+	for (int i = 0; i < this->threads.size(); i++) {
+		if (this->threads[i]->id == id) {
+			return(this->threads[i]->name);
+		}
+	}
+
+	return("");
+}
+
+const char* Profiler::intern(std::string name) {
+	static std::set<std::string> names;
+	static std::mutex namesMutex;
+
+	std::lock_guard<std::mutex> lock(namesMutex);
+	return(names.insert(name).first->c_str());
+}
+
+long long Profiler::now() {
+	return(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - profilerStart).count());
+}
+
+profileThread_t* Profiler::getThread() {
+	if (currentThread == NULL) {
+		profileThread_t* thread = new profileThread_t();
+		thread->written = 0;
+		thread->committed = 0;
+		thread->read = 0;
+		thread->depth = 0;
+
+		std::lock_guard<std::mutex> lock(this->threadsMutex);
+		thread->id = this->threads.size();
+		thread->name = "thread " + std::to_string(thread->id);
+		this->threads.push_back(thread);
+
+		currentThread = thread;
+	}
+
+	return(currentThread);
+}
+
+// the zones are recorded like any other and dropped before the collecting thread sees them
+void Profiler::calibrate() {
+	profileThread_t* thread = this->getThread();
+
+	if (thread->depth != 0) {
+		return;
+	}
+
+	long long start = now();
+
+	for (int i = 0; i < PROFILER_CALIBRATION_ZONES; i++) {
+		this->beginZone("calibration");
+		this->endZone();
+	}
+
+	this->zoneCost = (double)(now() - start) / PROFILER_CALIBRATION_ZONES;
+	thread->read = thread->committed.load(std::memory_order_acquire);
+
+	printf("profiler: %.1f ns per zone\n", this->zoneCost);
+}
+
+std::string Profiler::escapeJSON(std::string text) {
+	std::string escaped;
+
+	for (int i = 0; i < text.size(); i++) {
+		if (text[i] == '"' || text[i] == '\\') {
+			escaped += '\\';
+			escaped += text[i];
+		}
+		else if ((unsigned char)text[i] < 0x20) {
+			char code[8];
+			snprintf(code, sizeof(code), "\\u%04x", text[i]);
+			escaped += code;
+		}
+		else {
+			escaped += text[i];
+		}
+	}
+
+	return(escaped);
+}
+
+void Profiler::writeTrace() {
+	std::ofstream file(PROFILER_TRACE_PATH);
+
+	if (!file) {
+		printf("profiler: can't write %s\n", PROFILER_TRACE_PATH);
+		return;
+	}
+
+	char buffer[64];
+	const char* separator = "";
+
+	file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	{
+		std::lock_guard<std::mutex> lock(this->threadsMutex);
+
+		for (int i = 0; i < this->threads.size(); i++) {
+			file << separator << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << this->threads[i]->id;
+			file << ",\"args\":{\"name\":\"" << escapeJSON(this->threads[i]->name.c_str()) << "\"}}";
+			separator = ",";
+		}
+	}
+
+	// complete events, timestamps in microseconds
+	for (int i = 0; i < this->captureEvents.size(); i++) {
+		profileEvent_t event = this->captureEvents[i];
+
+		file << separator << "\n{\"name\":\"" << escapeJSON(event.name) << "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread;
+		snprintf(buffer, sizeof(buffer), ",\"ts\":%.3f,\"dur\":%.3f}", event.start / 1000.0, (event.end - event.start) / 1000.0);
+		file << buffer;
+		separator = ",";
+	}
+
+	file << "\n]}\n";
+
+	printf("profiler: wrote %d zones from %d frames to %s\n", (int)this->captureEvents.size(), PROFILER_CAPTURE_FRAMES, PROFILER_TRACE_PATH);
+	this->captureEvents.clear();
+}
+
+// constructor method
+ProfileZone::ProfileZone(const char* name) {
+	this->active = profiler->beginZone(name);
+}
+
+ProfileZone::~ProfileZone() {
+	if (this->active) {
+		profiler->endZone();
+	}
+}
@@ -0,0 +1,128 @@
+#ifndef __PROFILER__
+#define __PROFILER__
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// set to 0 to compile the zones out, the macros then expand to nothing
+#ifndef PROFILER
+#define PROFILER 1
+#endif
+
+// zones every thread can record before the oldest ones are overwritten, if they aren't collected in time
+#define PROFILER_THREAD_EVENTS 16384
+// deepest zone nesting recorded
+#define PROFILER_MAX_DEPTH 64
+// frames written to a chrome trace
+#define PROFILER_CAPTURE_FRAMES 120
+#define PROFILER_TRACE_PATH "../trace.json"
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if PROFILER
+// zone lasting until the end of the enclosing scope, the name has to outlive the profiler (a string literal)
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+// same as PROFILE_ZONE for names built at runtime, which are interned first
+#define PROFILE_ZONE_DYNAMIC(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(Profiler::intern(name))
+#else
+#define PROFILE_ZONE(name)
+#define PROFILE_ZONE_DYNAMIC(name)
+#endif
+
+// zone as it's recorded: timestamps in nanoseconds since the profiler started
+typedef struct {
+	const char* name;
+	long long start;
+	long long end;
+	int depth;
+	int thread;
+} profileEvent_t;
+
+// zones of one thread: only the thread writes them, and it publishes how many are complete once it leaves its
+// outermost zone, so the collecting thread reads them without a lock
+typedef struct {
+	int id;
+	std::string name;
+	profileEvent_t events[PROFILER_THREAD_EVENTS];
+	unsigned long long written;
+	std::atomic<unsigned long long> committed;
+	unsigned long long read;
+	unsigned long long stack[PROFILER_MAX_DEPTH];
+	int depth;
+} profileThread_t;
+
+// class collecting the zones of every thread once per frame, for the flame graph of the ui and the chrome trace export
+class Profiler {
+	public:
+		// constructor method
+		Profiler();
+
+		// methods for opening and closing a zone on the calling thread, begin returns false if the zone isn't recorded
+		bool beginZone(const char*);
+		void endZone();
+		// method for collecting the zones the threads finished since the last frame, called once per frame
+		void endFrame();
+
+		// method for naming the calling thread in the trace
+		void setThreadName(std::string);
+		// method for writing the next PROFILER_CAPTURE_FRAMES frames to PROFILER_TRACE_PATH
+		void captureTrace();
+
+		void setEnabled(bool);
+		bool isEnabled();
+		bool isCapturing();
+		// zones of the last frame, from every thread
+		std::vector<profileEvent_t> getFrameEvents();
+		// start and length of the last frame (ns)
+		long long getFrameStart();
+		long long getFrameDuration();
+		// cost of recording a zone (ns), measured when the profiler starts, and its share of the last frame
+		double getZoneCost();
+		double getOverhead();
+		// zones lost because a thread recorded more than its buffer holds between two frames
+		int getLostEvents();
+		std::string getThreadName(int);
+
+		// method for getting a pointer to a copy of a string that lives as long as the program
+		static const char* intern(std::string);
+		// nanoseconds since the profiler started
+		static long long now();
+		// text for a JSON string: quotes, backslashes and control characters escaped, for every JSON the engine writes
+		static std::string escapeJSON(std::string);
+
+	private:
+		std::atomic<bool> enabled;
+		std::vector<profileThread_t*> threads;
+		std::mutex threadsMutex;
+
+		std::vector<profileEvent_t> frameEvents;
+		long long frameStart;
+		long long frameDuration;
+		double zoneCost;
+		int lostEvents;
+
+		std::vector<profileEvent_t> captureEvents;
+		int captureFrames;
+
+		// method for getting the zones of the calling thread, registered the first time
+		profileThread_t* getThread();
+		// method for measuring the cost of a zone
+		void calibrate();
+		// method for writing the captured zones as chrome trace json
+		void writeTrace();
+};
+
+// zone recorded from its construction to its destruction
+class ProfileZone {
+	public:
+		ProfileZone(const char*);
+		~ProfileZone();
+
+	private:
+		bool active;
+};
+
+#endif
@@ -0,0 +1,346 @@
+#include "renderGraph.h"
+#include <glad\glad.h>
+#include <algorithm>
+#include <stdio.h>
+#include "init.h"
+
+// constructor method
+RenderGraph::RenderGraph() {
+	this->frame = 0;
+	this->timer = new GPUTimer();
+}
+
+void RenderGraph::reset() {
+	this->resources.clear();
+	this->passes.clear();
+	this->frame++;
+}
+
+int RenderGraph::createTexture(std::string name, unsigned int format, int width, int height, int samples, int levels, bool linear) {
+	renderResource_t resource;
+
+	resource.name = name;
+	resource.desc.format = format;
+	resource.desc.width = std::max(width, 1);
+	resource.desc.height = std::max(height, 1);
+	resource.desc.samples = samples;
+	resource.desc.levels = std::max(levels, 1);
+	resource.desc.layers = 1;
+	resource.desc.linear = linear;
+	resource.imported = false;
+	resource.output = false;
+	resource.texture = 0;
+	resource.firstPass = -1;
+	resource.lastPass = -1;
+
+	this->resources.push_back(resource);
+
+	return(this->resources.size() - 1);
+}
+
+int RenderGraph::importTexture(std::string name, unsigned int texture, renderTargetDesc_t desc, bool output) {
+	renderResource_t resource;
+
+	resource.name = name;
+	resource.desc = desc;
+	resource.imported = true;
+	resource.output = output;
+	resource.texture = texture;
+	resource.firstPass = -1;
+	resource.lastPass = -1;
+
+	this->resources.push_back(resource);
+
+	return(this->resources.size() - 1);
+}
+
+void RenderGraph::addPass(std::string name, std::vector<int> reads, std::vector<int> writes, bool enabled, std::function<void()> execute) {
+	renderPass_t pass;
+
+	pass.name = name;
+	pass.reads = reads;
+	pass.writes = writes;
+	pass.enabled = enabled;
+	pass.culled = !enabled;
+	pass.execute = execute;
+
+	this->passes.push_back(pass);
+}
+
+void RenderGraph::compile() {
+	// walking back from the outputs, a pass is kept if something after it reads what it writes
+	std::vector<bool> needed(this->resources.size(), false);
+
+	for (int i = 0; i < this->resources.size(); i++) {
+		needed[i] = this->resources[i].output;
+	}
+
+	for (int i = this->passes.size() - 1; i >= 0; i--) {
+		renderPass_t* pass = &this->passes[i];
+
+		pass->culled = true;
+
+		if (!pass->enabled) {
+			continue;
+		}
+
+		for (int j = 0; j < pass->writes.size(); j++) {
+			if (needed[pass->writes[j]]) {
+				pass->culled = false;
+			}
+		}
+
+		if (pass->culled) {
+			continue;
+		}
+
+		// a resource the pass overwrites without reading isn't needed from the passes before it
+		for (int j = 0; j < pass->writes.size(); j++) {
+			int resource = pass->writes[j];
+
+			if (std::find(pass->reads.begin(), pass->reads.end(), resource) == pass->reads.end() && !this->resources[resource].output) {
+				needed[resource] = false;
+			}
+		}
+
+		for (int j = 0; j < pass->reads.size(); j++) {
+			needed[pass->reads[j]] = true;
+		}
+	}
+
+	// lifetimes of the resources, in passes
+	for (int i = 0; i < this->passes.size(); i++) {
+		if (this->passes[i].culled) {
+			continue;
+		}
+
+		std::vector<int> used = this->passes[i].reads;
+		used.insert(used.end(), this->passes[i].writes.begin(), this->passes[i].writes.end());
+
+		for (int j = 0; j < used.size(); j++) {
+			renderResource_t* resource = &this->resources[used[j]];
+
+			if (resource->firstPass < 0) {
+				resource->firstPass = i;
+			}
+
+			resource->lastPass = i;
+		}
+	}
+
+	// the transient resources get a texture in order of first use, reusing a pooled texture with the same
+	// description whose previous resource is already dead
+	std::vector<int> order;
+
+	for (int i = 0; i < this->resources.size(); i++) {
+		if (!this->resources[i].imported && this->resources[i].firstPass >= 0) {
+			order.push_back(i);
+		}
+	}
+
+	std::sort(order.begin(), order.end(), [this](int a, int b) {
+		return(this->resources[a].firstPass < this->resources[b].firstPass);
+	});
+
+	for (int i = 0; i < this->pool.size(); i++) {
+		this->pool[i].busyUntil = -1;
+	}
+
+	for (int i = 0; i < order.size(); i++) {
+		renderResource_t* resource = &this->resources[order[i]];
+		int chosen = -1;
+
+		for (int j = 0; j < this->pool.size() && chosen < 0; j++) {
+			if (this->pool[j].busyUntil < resource->firstPass && this->sameDesc(this->pool[j].desc, resource->desc)) {
+				chosen = j;
+			}
+		}
+
+		if (chosen < 0) {
+			pooledTexture_t pooled;
+			pooled.desc = resource->desc;
+			pooled.texture = this->createPoolTexture(resource->desc);
+
+			this->pool.push_back(pooled);
+			chosen = this->pool.size() - 1;
+		}
+
+		this->pool[chosen].busyUntil = resource->lastPass;
+		this->pool[chosen].lastFrame = this->frame;
+		resource->texture = this->pool[chosen].texture;
+	}
+
+	// textures nobody asked for in a while (old resolutions, disabled effects) are given back
+	for (int i = this->pool.size() - 1; i >= 0; i--) {
+		if (this->frame - this->pool[i].lastFrame > RENDER_GRAPH_POOL_FRAMES) {
+			this->deletePoolTexture(i);
+		}
+	}
+}
+
+void RenderGraph::execute() {
+	this->timer->beginFrame();
+
+	for (int i = 0; i < this->passes.size(); i++) {
+		if (!this->passes[i].culled) {
+			PROFILE_ZONE_DYNAMIC(this->passes[i].name);
+
+			this->timer->begin(this->passes[i].name);
+			this->passes[i].execute();
+			this->timer->end();
+		}
+	}
+
+	this->timer->endFrame();
+}
+
+unsigned int RenderGraph::getTexture(int resource) {
+	return(this->resources[resource].texture);
+}
+
+unsigned int RenderGraph::getFramebuffer(unsigned int color, unsigned int depth) {
+	std::vector<unsigned int> key;
+	key.push_back(color);
+	key.push_back(depth);
+
+	std::map<std::vector<unsigned int>, unsigned int>::iterator cached = this->framebuffers.find(key);
+
+	if (cached != this->framebuffers.end()) {
+		return(cached->second);
+	}
+
+	unsigned int framebuffer = glState->createFramebuffer();
+
+	if (color != 0) {
+		glState->framebufferTexture(framebuffer, GL_COLOR_ATTACHMENT0, color, 0, -1);
+	}
+	else {
+		glState->framebufferDrawBuffer(framebuffer, GL_NONE);
+	}
+
+	if (depth != 0) {
+		glState->framebufferTexture(framebuffer, GL_DEPTH_STENCIL_ATTACHMENT, depth, 0, -1);
+	}
+
+	int framebufferStatus = glState->checkFramebufferStatus(framebuffer);
+
+	if (framebufferStatus != GL_FRAMEBUFFER_COMPLETE) {
+		printf("framebuffer error: %d\n", framebufferStatus);
+	}
+
+	this->framebuffers[key] = framebuffer;
+
+	return(framebuffer);
+}
+
+std::vector<renderPass_t>* RenderGraph::getPasses() {
+	return(&this->passes);
+}
+
+GPUTimer* RenderGraph::getTimer() {
+	return(this->timer);
+}
+
+size_t RenderGraph::getMemory() {
+	size_t memory = 0;
+
+	for (int i = 0; i < this->pool.size(); i++) {
+		memory += RenderGraph::getSize(this->pool[i].desc);
+	}
+
+	// the default framebuffer (texture 0) belongs to the window
+	for (int i = 0; i < this->resources.size(); i++) {
+		if (this->resources[i].imported && this->resources[i].texture != 0) {
+			memory += RenderGraph::getSize(this->resources[i].desc);
+		}
+	}
+
+	return(memory);
+}
+
+size_t RenderGraph::getUnaliasedMemory() {
+	size_t memory = 0;
+
+	for (int i = 0; i < this->resources.size(); i++) {
+		if ((this->resources[i].imported && this->resources[i].texture != 0) || this->resources[i].firstPass >= 0) {
+			memory += RenderGraph::getSize(this->resources[i].desc);
+		}
+	}
+
+	return(memory);
+}
+
+int RenderGraph::getPoolSize() {
+	return(this->pool.size());
+}
+
+size_t RenderGraph::getSize(renderTargetDesc_t desc) {
+	size_t bytesPerPixel;
+
+	switch (desc.format) {
+	case GL_RGBA16F:
+		bytesPerPixel = 8;
+		break;
+
+	// RGB8 is stored with padding by the drivers
+	default:
+		bytesPerPixel = 4;
+	}
+
+	size_t size = 0;
+	size_t width = desc.width;
+	size_t height = desc.height;
+
+	for (int level = 0; level < desc.levels; level++) {
+		size += width * height * bytesPerPixel;
+		width = std::max(width / 2, (size_t)1);
+		height = std::max(height / 2, (size_t)1);
+	}
+
+	return(size * std::max(desc.samples, 1) * std::max(desc.layers, 1));
+}
+
+bool RenderGraph::sameDesc(renderTargetDesc_t a, renderTargetDesc_t b) {
+	return(a.format == b.format && a.width == b.width && a.height == b.height && a.samples == b.samples &&
+		a.levels == b.levels && a.linear == b.linear);
+}
+
+unsigned int RenderGraph::createPoolTexture(renderTargetDesc_t desc) {
+	if (desc.samples > 0) {
+		return(glState->createTexture(GL_TEXTURE_2D_MULTISAMPLE, desc.format, desc.width, desc.height, 1, desc.samples));
+	}
+
+	unsigned int texture = glState->createTexture(GL_TEXTURE_2D, desc.format, desc.width, desc.height, desc.levels, 0);
+
+	// the filtering lives in shared samplers, integer formats need nearest filtering to be complete
+	GLenum filter = desc.linear ? GL_LINEAR : GL_NEAREST;
+
+	if (desc.levels > 1) {
+		glState->setTextureSampler(texture, glState->getSampler(GL_NEAREST_MIPMAP_NEAREST, filter, GL_CLAMP_TO_EDGE));
+	}
+	else {
+		glState->setTextureSampler(texture, glState->getSampler(filter, filter, GL_CLAMP_TO_EDGE));
+	}
+
+	return(texture);
+}
+
+// delete a pooled texture and the framebuffers it's attached to
+void RenderGraph::deletePoolTexture(int index) {
+	unsigned int texture = this->pool[index].texture;
+
+	std::map<std::vector<unsigned int>, unsigned int>::iterator it = this->framebuffers.begin();
+
+	while (it != this->framebuffers.end()) {
+		if (it->first[0] == texture || it->first[1] == texture) {
+			glState->deleteFramebuffers(1, &it->second);
+			it = this->framebuffers.erase(it);
+		}
+		else {
+			it++;
+		}
+	}
+
+	glState->deleteTextures(1, &texture);
+	this->pool.erase(this->pool.begin() + index);
+}
@@ -0,0 +1,116 @@
+#ifndef __RENDERGRAPH__
+#define __RENDERGRAPH__
+
+#include <vector>
+#include <map>
+#include <string>
+#include <functional>
+#include "gpuTimer.h"
+
+// frames a texture of the pool can stay unused before it's deleted
+#define RENDER_GRAPH_POOL_FRAMES 60
+
+// struct for describing a render target, resources with the same description can share a texture
+typedef struct {
+	// internal format
+	unsigned int format;
+	int width;
+	int height;
+	// 0 for a regular texture, the number of samples for a multisampled one
+	int samples;
+	// mip levels
+	int levels;
+	// cubemap faces or textures of the same size (ping-pong pairs), only used for the memory of imported textures
+	int layers;
+	// linear or nearest filtering
+	bool linear;
+} renderTargetDesc_t;
+
+// struct for saving the informations about a texture used by the passes
+typedef struct {
+	std::string name;
+	renderTargetDesc_t desc;
+	// imported textures are owned outside the graph (history, cubemaps, the screen as texture 0), they're only tracked
+	bool imported;
+	// the passes writing an output are never culled (the screen, the history of the next frame)
+	bool output;
+	unsigned int texture;
+	// first and last pass using the resource this frame, -1 if it's not used
+	int firstPass;
+	int lastPass;
+} renderResource_t;
+
+// struct for saving the informations about a pass
+typedef struct {
+	std::string name;
+	std::vector<int> reads;
+	std::vector<int> writes;
+	// passes can be switched off, the passes that only fed them are culled with them
+	bool enabled;
+	bool culled;
+	std::function<void()> execute;
+} renderPass_t;
+
+// struct for saving a texture of the pool
+typedef struct {
+	renderTargetDesc_t desc;
+	unsigned int texture;
+	// last pass of the resource the texture is assigned to, another resource can take it after that
+	int busyUntil;
+	// last frame the texture was used in
+	int lastFrame;
+} pooledTexture_t;
+
+// class for describing the offscreen passes of a frame with the textures they read and write: the passes that don't
+// contribute to an output are culled and the transient textures come from a pool, where resources whose lifetimes
+// don't overlap share the same texture
+class RenderGraph {
+	public:
+		// constructor method
+		RenderGraph();
+
+		// method for starting the description of a new frame
+		void reset();
+		// method for declaring a texture that only lives inside the frame (name, format, width, height, samples, levels, linear)
+		int createTexture(std::string, unsigned int, int, int, int, int, bool);
+		// method for declaring a texture owned outside the graph (name, texture, description, output)
+		int importTexture(std::string, unsigned int, renderTargetDesc_t, bool);
+		// method for adding a pass (name, read resources, written resources, enabled, function drawing the pass)
+		void addPass(std::string, std::vector<int>, std::vector<int>, bool, std::function<void()>);
+		// method for culling the passes and assigning a texture to every resource that's used
+		void compile();
+		// method for running the passes that weren't culled, in the order they were added, timing each of them
+		void execute();
+
+		// texture assigned to a resource, 0 if no pass uses it
+		unsigned int getTexture(int);
+		// framebuffer with the given color and depth-stencil textures attached (0 for none), created the first time
+		unsigned int getFramebuffer(unsigned int, unsigned int);
+
+		std::vector<renderPass_t>* getPasses();
+		// GPU and CPU time of the passes
+		GPUTimer* getTimer();
+		// memory of the textures in the pool and of the imported ones, in bytes
+		size_t getMemory();
+		// memory the transient resources of this frame would take with a texture each, in bytes
+		size_t getUnaliasedMemory();
+		int getPoolSize();
+
+		// memory taken by a texture with the given description, in bytes
+		static size_t getSize(renderTargetDesc_t);
+
+	private:
+		std::vector<renderResource_t> resources;
+		std::vector<renderPass_t> passes;
+		std::vector<pooledTexture_t> pool;
+		// framebuffers by their color and depth-stencil textures
+		std::map<std::vector<unsigned int>, unsigned int> framebuffers;
+		int frame;
+		GPUTimer* timer;
+
+		bool sameDesc(renderTargetDesc_t, renderTargetDesc_t);
+		unsigned int createPoolTexture(renderTargetDesc_t);
+		void deletePoolTexture(int);
+};
+
+#endif
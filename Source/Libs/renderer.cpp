@@ -1,1214 +1,1784 @@
-#include "renderer.h"
-#include "entity.h"
-#include "camera.h"
-#include "shader.h"
-#include <vector>
-#include <glad\glad.h>
-#include <glm\glm.hpp>
-#include <glm\gtc\matrix_transform.hpp>
-#include <glm\gtc\type_ptr.hpp>
-#include <SFML\Graphics.hpp>
-#include "init.h"
-#include <iostream>
-#include <string>
-
-// constructor method, sets up the renderer (reflection and post processing)
-Renderer::Renderer() {
-	// sets the color to clear the color buffer with
-	glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
-
-	// enable multisampling
-	glEnable(GL_MULTISAMPLE);
-	glEnable(GL_STENCIL_TEST);
-
-	// enables back-face culling:
-	// polygons aren't rendered if the vertices that define the triangle are seen clockwise or counterclockwise,
-	// a face with vertices indexed in the opposite order suggest that it's being viewed from the other side,
-	// which is usually the inside of the model, which doesn't need to be rendered
-	glEnable(GL_CULL_FACE);
-	glCullFace(GL_BACK);
-
-	// generate 1 generic buffer and assigns its ID to the variable tmpBuffer
-	glGenBuffers(1, &this->tmpBuffer);
-
-
-	/*--------------------------------------------------------------------------*/
-	/*                             REFLECTION SETUP                             */
-	/*--------------------------------------------------------------------------*/
-
-	// defines the resolution of the reflection cubemap
-	this->reflectionRes = 2048;
-
-	// generate the framebuffer that is gonna store the view from the reflection camera
-	glGenFramebuffers(1, &this->reflectionFBO);
-	// bind the newly generated framebuffer to the default framebuffer, both in read and write
-	glBindFramebuffer(GL_FRAMEBUFFER, this->reflectionFBO);
-
-	/* ACTIVE FRAMEBUFFER: reflectionFBO */
-
-	// generate a generic texture for the cubemap reflection
-	glGenTextures(1, &this->reflectionCubemap);
-	// actually creates and binds the cubemap placeholder to the actual cubemap
-	glBindTexture(GL_TEXTURE_CUBE_MAP, this->reflectionCubemap);
-
-	/* ACTIVE TEXTURE: reflectionCubemap */
-
-	// cycle through the faces of the cubemap
-	for (int i = 0; i < 6; i++) {
-		// generate an empty (NULL) texture at the target (active texture @ GL_TEXTURE_CUBE_MAP_POSITIVE_X ... GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)
-		// with no mipmap level, RGB color internal format, reflectionRex x reflectionRes for the resolution, no border, RGB color format,
-		// UNSIGNED_BYTE pixel data format
-		glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, this->reflectionRes, this->reflectionRes, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
-	}
-
-	// set texture parameters (GL_TEXTURE_CUBE_MAP = target (in this case it refers to cubemap))
-	// set the texture display filter when switching mipmaps (needs more testing and studying)
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	// set the texture display filter when switching mipmaps (needs more testing and studying)
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	// set the texture to shrink or stretch to the edge of the texture space in the S, T and R axis
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-
-	// generates one render buffer to attach to the framebuffer to store the image data (more optimized than textures for targets)
-	glGenRenderbuffers(1, &this->reflectionRBO);
-	// bind renderBuffer to the default GL_RENDERBUFFER
-	glBindRenderbuffer(GL_RENDERBUFFER, this->reflectionRBO);
-
-	/* ACTIVE RENDERBUFFER: reflectionRBO */
-
-	// define render buffer multisample (needs more study)
-	glRenderbufferStorageMultisample(GL_RENDERBUFFER, 8, GL_DEPTH24_STENCIL8, this->reflectionRes, this->reflectionRes);
-	// attach renderBuffer to the current framebuffer (frameBuffer)
-	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, this->reflectionRBO);
-
-	// set back the renderbuffer to the default renderbuffer
-	glBindRenderbuffer(GL_RENDERBUFFER, 0);
-
-	/* ACTIVE RENDERBUFFER: Default */
-
-	/*-------------------------------------------------------------------------------*/
-	/*                             POST PROCESSING SETUP                             */
-	/*-------------------------------------------------------------------------------*/
-	
-	// create an empty texture object for screenTexture, this texture will be bound to the screenFBO
-	// and will store the screen view image
-	glGenTextures(1, &this->screenTexture);
-	// bind the screenTexture texture as the main texture
-	glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->screenTexture);
-	
-	/* ACTIVE TEXTURE: screenTexture */
-
-	// create the actual texture for image with res: screenWidth x screenHeight
-	glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, samples, GL_RGB, screenWidth, screenHeight, false);
-
-	// create an empty texture for the depth texture
-	glGenTextures(1, &this->screenDepthTexture);
-	// bind the screenTexture texture as the main texture
-	glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->screenDepthTexture);
-	
-	/* ACTIVE TEXTURE: screenDepthTexture */
-
-	// create the actual texture for image with res: screenWidth x screenHeight
-	glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, samples, GL_DEPTH_STENCIL, screenWidth, screenHeight, false);
-	//glTextureParameteri(this->screenDepthTexture, GL_DEPTH_STENCIL_TEXTURE_MODE, GL_STENCIL_INDEX);
-	// create the screenFBO (used for rendering the screen view to a texture)
-	glGenFramebuffers(1, &this->screenFBO);
-	// bind the screenFBO to be the default FBO
-	glBindFramebuffer(GL_FRAMEBUFFER, this->screenFBO);
-
-
-	glGenTextures(1, &this->outlineTextureMask);
-	glBindTexture(GL_TEXTURE_2D, this->outlineTextureMask);
-	//glTexImage2DMultisample(GL_TEXTURE_2D, samples, GL_RGB, screenWidth, screenHeight, false);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, screenWidth, screenHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	
-
-	/* ACTIVE FRAMEBUFFER: screenFBO */
-
-	// attach the screenTexture to the screenFBO, so that the stuff rendered on the screenFBO can be saved to the screenTexture
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D_MULTISAMPLE, this->screenTexture, 0);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D_MULTISAMPLE, this->screenDepthTexture, 0);
-
-	int framebufferStatus = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-
-	if (framebufferStatus != GL_FRAMEBUFFER_COMPLETE) {
-		printf("framebuffer error: %d\n", framebufferStatus);
-	}
-
-	glGenTextures(1, &this->postProcessingTexture);
-	glBindTexture(GL_TEXTURE_2D, this->postProcessingTexture);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, screenWidth, screenHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-	glGenTextures(1, &this->postProcessingDepthTexture);
-	glBindTexture(GL_TEXTURE_2D, this->postProcessingDepthTexture);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, screenWidth, screenHeight, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_BYTE, NULL);
-
-	glGenFramebuffers(1, &this->postProcessingFBO);
-	glBindFramebuffer(GL_FRAMEBUFFER, this->postProcessingFBO);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, this->postProcessingTexture, 0);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, this->postProcessingDepthTexture, 0);
-
-	framebufferStatus = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-
-	if (framebufferStatus != GL_FRAMEBUFFER_COMPLETE) {
-		printf("framebuffer error: %d\n", framebufferStatus);
-	}
-
-	// create a square of vertices for the post processing shader
-	std::vector<float> square;
-	square.push_back(-1.0f); // bottom-left
-	square.push_back(1.0f);
-
-	square.push_back(-1.0f); // top-left
-	square.push_back(-1.0f);
-
-	square.push_back(1.0f); //  top-right
-	square.push_back(-1.0f);
-
-
-	square.push_back(-1.0f); // bottom-left
-	square.push_back(1.0f);
-
-	square.push_back(1.0f); //  top-right
-	square.push_back(-1.0f);
-
-	square.push_back(1.0f); //  bottom-right
-	square.push_back(1.0f);
-
-	// create the VBO to store the square vertices
-	glGenBuffers(1, &this->screenVBO);
-	// set the current active VBO to the screenVBO
-	glBindBuffer(GL_ARRAY_BUFFER, this->screenVBO);
-
-	/* ACTIVE BUFFER: screenVBO */
-
-	// pass the vertices to the buffer
-	glBufferData(GL_ARRAY_BUFFER, square.size() * sizeof(float), &square[0], GL_STATIC_DRAW);
-
-	// create the UV coordinates to map the screen texture to the screen square
-	std::vector<float> uv;
-	uv.push_back(0.0f); // bottom-left
-	uv.push_back(1.0f);
-
-	uv.push_back(0.0f); // top-left
-	uv.push_back(0.0f);
-
-	uv.push_back(1.0f); // top-right
-	uv.push_back(0.0f);
-
-
-	uv.push_back(0.0f); // bottom-left
-	uv.push_back(1.0f);
-
-	uv.push_back(1.0f); // top-right
-	uv.push_back(0.0f);
-
-	uv.push_back(1.0f); // bottom-right
-	uv.push_back(1.0f);
-
-	// create the VBO to store the UV vertices
-	glGenBuffers(1, &this->screenUVVBO);
-	// set the current active VBO to the screenUVVBO
-	glBindBuffer(GL_ARRAY_BUFFER, this->screenUVVBO);
-
-	/* ACTIVE BUFFER: screenUVVBO*/
-
-	// pass the UV coordinates to the buffer
-	glBufferData(GL_ARRAY_BUFFER, uv.size() * sizeof(float), &uv[0], GL_STATIC_DRAW);
-
-	// create the shader object to hold the post processing shader
-	this->screenShader = new Shader((char*)"screen shader");
-	// load the post processing shader
-	this->screenShader->loadShader((char*)"../Shader/screen/screen.vert", (char*)"../Shader/screen/screen.frag");
-
-	// create the shader object to hold the post processing depth buffer display shader
-	this->depthShader = new Shader((char*)"depth shader");
-	// load the post processing depth buffer display shader
-	this->depthShader->loadShader((char*)"../Shader/depth/depth.vert", (char*)"../Shader/depth/depth.frag");
-
-	this->postProcessingShader = new Shader((char*)"post-processing shader");
-	this->postProcessingShader->loadShader((char*)"../Shader/postProcessing/postProcessing.vert", (char*)"../Shader/postProcessing/postProcessing.frag");
-
-	int maxSamples;
-	glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
-	printf("max samples: %d\n", maxSamples);
-}
-
-// public method for rendering the scene
-void Renderer::render() {
-	if (updateResolution) {
-		this->resizeScreen();
-	}
-
-	// ------------------------------ REFLECTION FRAMEBUFFER RENDERING ------------------------------ //
-
-	this->reflectionRenderTime = glfwGetTime();
-
-	// check if the program should render the reflection cubemap
-	if (doReflection) {
-		glBindFramebuffer(GL_FRAMEBUFFER, this->reflectionFBO);
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-		// render the reflection cubemap
-		this->renderReflectionCubemap();
-	}	
-
-	this->reflectionRenderTime = glfwGetTime() - this->reflectionRenderTime;
-	
-	// -------------------------------- SCREEN FRAMEBUFFER RENDERING -------------------------------- //
-
-	this->forwardRenderTime = glfwGetTime();
-
-	glBindFramebuffer(GL_FRAMEBUFFER, this->screenFBO);
-	glEnable(GL_STENCIL_TEST);
-	glStencilOp(GL_KEEP,	   // stencil fail
-				GL_KEEP,	   // stencil pass, depth fail
-				GL_REPLACE);   // stencil pass, depth pass
-	
-	glStencilMask(0xFF);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
-
-	this->renderEntities(false);
-
-	// draw the bounding box for each entity
-	this->displayBoundingBox();
-
-	this->forwardRenderTime = glfwGetTime() - this->forwardRenderTime;
-
-	// ---------------------------- POST PROCESSING FRAMEBUFFER RENDERING --------------------------- //
-
-	this->MSPostProcessingPassTime = glfwGetTime();
-
-	this->renderMultisamplePostProcessing();
-
-	this->MSPostProcessingPassTime = glfwGetTime() - this->MSPostProcessingPassTime;
-
-
-	this->postProcessingPassTime = glfwGetTime();
-
-	if (this->highlightedEntity >= 0 && (outlineType == 0 || outlineType == 1)) {
-		this->renderOutline();
-	}
-
-	// ---------------------------------- OUT FRAMEBUFFER RENDERING --------------------------------- //
-
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-	this->renderScreen();
-
-	this->postProcessingPassTime = glfwGetTime() - this->postProcessingPassTime;
-}
-
-// render the cubemap view from the reflection camera to later calculate reflections on
-void Renderer::renderReflectionCubemap() {
-	// set the current camera to the camera inside the reflective object
-	defaultCamera = 1;
-
-	/* ACTIVE CAMERA: camera2 */
-
-	// set the viewport to fit the reflection texture resolution
-	glViewport(0, 0, reflectionRes, reflectionRes);
-
-	// cycle all the faces of the cubemap
-	for (int i = 0; i < 6; i++) {
-		// attach the positive X texture of the reflectionCubemap to the color buffer of the reflectionFBO
-		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, this->reflectionCubemap, 0);
-		// aim the camera to face the correct direction
-		if (i == 0)      // FRONT
-			camera2.setOrientation(glm::vec3(0.0, 0.0, 0.0));
-		else if (i == 1) // BACK
-			camera2.setOrientation(glm::vec3(0.0, 180.0, 0.0));
-		else if (i == 2) // TOP
-			camera2.setOrientation(glm::vec3(0.0, -90.0, 90.0));
-		else if (i == 3) // BOTTOM
-			camera2.setOrientation(glm::vec3(0.0, -90.0, -90.0));
-		else if (i == 4) // RIGHT
-			camera2.setOrientation(glm::vec3(0.0, 90.0, 0.0));
-		else             // LEFT
-			camera2.setOrientation(glm::vec3(0.0, 270.0, 0.0));
-
-		// render all entities except for the ones that shouldn't be rendered in the reflection
-		this->renderEntities(true);
-		// clear the depth buffers from the reflectionFBO
-		glClear(GL_DEPTH_BUFFER_BIT);
-	}
-
-	// reset the viewport
-	glViewport(0, 0, screenWidth, screenHeight);
-
-	// set the render camera to the default camera
-	defaultCamera = 0;
-
-	/* ACTIVE CAMERA: camera1 */
-}
-
-// render all entities with their corresponding shader (forward rendering)
-void Renderer::renderEntities(bool reflection) {
-	glStencilMask(0);
-	glStencilFunc(GL_ALWAYS, 1, 255);
-
-	// render entities
-	for (int i = 0; i < entityBuffer.size(); i++) {
-		// if it's rendering entities to be displayed in the reflection:
-		if (reflection) {
-			// check what entities are supposed to be rendered in the reflection
-			if (entityBuffer[i]->getToReflect() == true) {
-				// if it's rendering the skybox
-				if (entityBuffer[i]->getName().compare("skybox") == 0) {
-					// disable the depth mask (the rendering won't write into the depth buffer)
-					glDepthMask(GL_FALSE);
-				}
-
-				// installs the shader to render the entity (it gets the shader from the entity)
-				glUseProgram(shaderBuffer[entityBuffer[i]->getShader()].getID());
-
-				// pass the values for the shader uniforms.
-				// shader uniforms are global variables for shaders that can be set by the user.
-				// uniforms are global to all shaders, so they don't need to be set by every shader call if the value doesn't change
-				// for example matrices for 3D rendering usually don't change between shaders (some optimization is possible)
-				this->attachUniforms(entityBuffer[i], shaderBuffer[entityBuffer[i]->getShader()].getUniformBuffer());
-
-				// link the layouts to the data origin.
-				// layouts define where the data for a certain variable comes from
-				this->linkLayouts(entityBuffer[i], shaderBuffer[entityBuffer[i]->getShader()].getLayoutBuffer());
-
-				// if the entity has a texture attached to it
-				if (entityBuffer[i]->getTexture() != 0) {
-					// bind it as the current active texture
-					glBindTexture(entityBuffer[i]->getTextureType(), entityBuffer[i]->getTexture());
-				}
-
-				// check which mode things should be rendered as
-				// if we're rendering the skybox, always render as triangles (weird results if you render with different primitives)
-				if (entityBuffer[i]->getName().compare("skybox") == 0) {
-					// render the skybox
-					glDrawArrays(GL_TRIANGLES, 0, entityBuffer[i]->getVertices().size());
-					// re-enable the depth mask (now rendering also affects the depth buffer as well)
-					glDepthMask(GL_TRUE);
-				}
-
-				else {
-					switch (renderMode) {
-						// draw lines
-					case wireframe:
-						glDrawArrays(GL_LINES, 0, entityBuffer[i]->getVertices().size());
-						break;
-
-						// draw points
-					case vertices:
-						glPointSize(2.0f);
-						glDrawArrays(GL_POINTS, 0, entityBuffer[i]->getVertices().size());
-						break;
-
-						// draw in the element's primitive (mainly triangles)
-					default:
-						glDrawArrays(entityBuffer[i]->getElements(), 0, entityBuffer[i]->getVertices().size());
-					}
-				}
-			}
-		}
-
-		else {
-			if (i != this->highlightedEntity) {
-				if (entityBuffer[i]->getName().compare("skybox") == 0) {
-					glDepthMask(GL_FALSE);
-				}
-
-				glUseProgram(shaderBuffer[entityBuffer[i]->getShader()].getID());
-
-				attachUniforms(entityBuffer[i], shaderBuffer[entityBuffer[i]->getShader()].getUniformBuffer());
-
-				linkLayouts(entityBuffer[i], shaderBuffer[entityBuffer[i]->getShader()].getLayoutBuffer());
-
-				if (entityBuffer[i]->getTexture() != 0) {
-					glBindTexture(entityBuffer[i]->getTextureType(), entityBuffer[i]->getTexture());
-				}
-
-				if (strcmp(shaderBuffer[entityBuffer[i]->getShader()].getName(), "reflection") == 0 ||
-					strcmp(shaderBuffer[entityBuffer[i]->getShader()].getName(), "refraction/glass") == 0 ||
-					strcmp(shaderBuffer[entityBuffer[i]->getShader()].getName(), "reflection/diamond") == 0) {
-					if (doReflection) {
-						glBindTexture(GL_TEXTURE_CUBE_MAP, this->reflectionCubemap);
-					}
-					else {
-						glBindTexture(GL_TEXTURE_CUBE_MAP, entityBuffer[0]->getTexture());
-					}
-					
-				}
-
-				// check which mode things should be rendered as
-				if (entityBuffer[i]->getName().compare("skybox") == 0) {
-					// render the skybox
-					glDrawArrays(GL_TRIANGLES, 0, entityBuffer[i]->getVertices().size());
-					// re-enable the depth mask (now rendering also affects the depth buffer as well)
-					glDepthMask(GL_TRUE);
-				}
-
-				else {
-					switch (renderMode) {
-					case wireframe:
-						glLineWidth(5.0f);
-						glDrawArrays(GL_LINES, 0, entityBuffer[i]->getVertices().size());
-						break;
-
-					case vertices:
-						glPointSize(2.0f);
-						glDrawArrays(GL_POINTS, 0, entityBuffer[i]->getVertices().size());
-						break;
-
-					default:
-						glDrawArrays(entityBuffer[i]->getElements(), 0, entityBuffer[i]->getVertices().size());
-					}
-				}
-			}
-		}
-
-		glDisableVertexAttribArray(0);
-		glDisableVertexAttribArray(1);
-		glDisableVertexAttribArray(2);
-	}
-
-	// render highlighted entity
-	if (this->highlightedEntity >= 0 && reflection == false) {
-		glStencilFunc(GL_ALWAYS, 1, 255);
-		glStencilMask(255);
-		this->renderEntity(entityBuffer[this->highlightedEntity]);
-
-		glStencilMask(0);
-		glStencilFunc(GL_NOTEQUAL, 1, 255);
-
-		glDisable(GL_DEPTH_TEST);
-		int previousShader = entityBuffer[this->highlightedEntity]->getShader();
-		entityBuffer[this->highlightedEntity]->setShader(11);
-		this->renderEntity(entityBuffer[this->highlightedEntity]);
-		entityBuffer[this->highlightedEntity]->setShader(previousShader);
-		glEnable(GL_DEPTH_TEST);
-
-		// wireframe outline implementation
-		if (outlineType == 2) {
-			glDisable(GL_DEPTH_TEST);
-			glPolygonMode(GL_FRONT, GL_LINE);
-			glLineWidth(10.0f);
-			int previousShader = entityBuffer[this->highlightedEntity]->getShader();
-			entityBuffer[this->highlightedEntity]->setShader(11);
-			this->renderEntity(entityBuffer[this->highlightedEntity]);
-			entityBuffer[this->highlightedEntity]->setShader(previousShader);
-			glLineWidth(1.0f);
-			glPolygonMode(GL_FRONT, GL_FILL);
-			glEnable(GL_DEPTH_TEST);
-		}
-	}
-}
-
-void Renderer::renderEntity(Entity* entity) {
-	if (entity->getName().compare("skybox") == 0) {
-		glDepthMask(GL_FALSE);
-	}
-
-	glUseProgram(shaderBuffer[entity->getShader()].getID());
-
-	attachUniforms(entity, shaderBuffer[entity->getShader()].getUniformBuffer());
-
-	linkLayouts(entity, shaderBuffer[entity->getShader()].getLayoutBuffer());
-
-	if (entity->getTexture() != 0) {
-		glBindTexture(entity->getTextureType(), entity->getTexture());
-	}
-
-	if (strcmp(shaderBuffer[entity->getShader()].getName(), "reflection") == 0 ||
-		strcmp(shaderBuffer[entity->getShader()].getName(), "refraction/glass") == 0 ||
-		strcmp(shaderBuffer[entity->getShader()].getName(), "reflection/diamond") == 0) {
-		if (doReflection) {
-			glBindTexture(GL_TEXTURE_CUBE_MAP, this->reflectionCubemap);
-		}
-		else {
-			glBindTexture(GL_TEXTURE_CUBE_MAP, entityBuffer[0]->getTexture());
-		}
-	}
-
-
-	// check which mode things should be rendered as
-	if (entity->getName().compare("skybox") == 0) {
-		// render the skybox
-		glDrawArrays(GL_TRIANGLES, 0, entity->getVertices().size());
-		// re-enable the depth mask (now rendering also affects the depth buffer as well)
-		glDepthMask(GL_TRUE);
-	}
-
-	else {
-		switch (renderMode) {
-		case wireframe:
-			glDrawArrays(GL_LINES, 0, entity->getVertices().size());
-			break;
-
-		case vertices:
-			glPointSize(2.0f);
-			glDrawArrays(GL_POINTS, 0, entity->getVertices().size());
-			break;
-
-		default:
-			glDrawArrays(entity->getElements(), 0, entity->getVertices().size());
-
-		}
-	}
-
-	glDisableVertexAttribArray(0);
-	glDisableVertexAttribArray(1);
-	glDisableVertexAttribArray(2);
-}
-
-
-void Renderer::renderOutline() {
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, this->outlineTextureMask, 0);
-
-	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-	glClear(GL_COLOR_BUFFER_BIT);
-	glDisable(GL_DEPTH_TEST);
-	glDisable(GL_STENCIL_TEST);
-	int previousShader = entityBuffer[this->highlightedEntity]->getShader();
-
-	entityBuffer[this->highlightedEntity]->setShader(13);
-	
-	this->renderEntity(entityBuffer[this->highlightedEntity]);
-	entityBuffer[this->highlightedEntity]->setShader(previousShader);
-	glEnable(GL_DEPTH_TEST);
-	glEnable(GL_STENCIL_TEST);
-	glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
-
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, this->postProcessingTexture, 0);
-
-	glDisable(GL_DEPTH_TEST);
-	glDisable(GL_STENCIL_TEST);
-
-	int shaderOutline;
-	if (outlineType == 0) {
-		shaderOutline = 12;
-	}
-	else if (outlineType == 1) {
-		shaderOutline = 14;
-	}
-
-	glUseProgram(shaderBuffer[shaderOutline].getID());
-
-	int screenTexUniformID = glGetUniformLocation(shaderBuffer[shaderOutline].getID(), "screenTexture");
-	int outlineMaskUniformID = glGetUniformLocation(shaderBuffer[shaderOutline].getID(), "outlineMask");
-
-	glUniform1i(screenTexUniformID, 0);
-	glUniform1i(outlineMaskUniformID, 1);
-
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, this->postProcessingTexture);
-
-	glActiveTexture(GL_TEXTURE1);
-	glBindTexture(GL_TEXTURE_2D, this->outlineTextureMask);
-
-	glEnableVertexAttribArray(0);
-	glBindBuffer(GL_ARRAY_BUFFER, this->screenVBO);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-	glEnableVertexAttribArray(1);
-	glBindBuffer(GL_ARRAY_BUFFER, this->screenUVVBO);
-	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-	glDrawArrays(GL_TRIANGLES, 0, 6);
-	glActiveTexture(GL_TEXTURE0);
-	glEnable(GL_DEPTH_TEST);
-	glEnable(GL_STENCIL_TEST);
-}
-
-
-void Renderer::renderMultisamplePostProcessing() {
-	glBindFramebuffer(GL_FRAMEBUFFER, this->postProcessingFBO);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-	glDisable(GL_DEPTH_TEST); // disable depth test so screen-space quad isn't discarded due to depth test.
-
-	if (depthBuffer) {
-		glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->screenDepthTexture);
-		glUseProgram(this->depthShader->getID());
-		glUniform1i(glGetUniformLocation(this->screenShader->getID(), "samples"), 1);
-	}
-	else {
-		glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->screenTexture);
-		glUseProgram(this->screenShader->getID());
-		glUniform1i(glGetUniformLocation(this->screenShader->getID(), "samples"), samples);
-	}
-
-	/*if (this->highlightedEntity >= 0 && !depthBuffer) {
-		glUniform1i(glGetUniformLocation(this->screenShader->getID(), "samples"), 1);
-	}
-	else {
-		glUniform1i(glGetUniformLocation(this->screenShader->getID(), "samples"), samples);
-	}*/
-
-	
-
-	glEnableVertexAttribArray(0);
-	glBindBuffer(GL_ARRAY_BUFFER, this->screenVBO);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-	glEnableVertexAttribArray(1);
-	glBindBuffer(GL_ARRAY_BUFFER, this->screenUVVBO);
-	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-	glDrawArrays(GL_TRIANGLES, 0, 6);
-
-	glEnable(GL_DEPTH_TEST);
-	glDisableVertexAttribArray(0);
-	glDisableVertexAttribArray(1);
-}
-
-// render the screen texture applying post processing shaders
-void Renderer::renderScreen() {
-	glDisable(GL_DEPTH_TEST); // disable depth test so screen-space quad isn't discarded due to depth test.
-
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, this->postProcessingTexture);
-	glUseProgram(this->postProcessingShader->getID());
-
-	glEnableVertexAttribArray(0);
-	glBindBuffer(GL_ARRAY_BUFFER, this->screenVBO);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-	glEnableVertexAttribArray(1);
-	glBindBuffer(GL_ARRAY_BUFFER, this->screenUVVBO);
-	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-	int screenTexUniformID = glGetUniformLocation(this->postProcessingShader->getID(), "screenTexture");
-
-	glUniform1i(screenTexUniformID, 0);
-
-	glDrawArrays(GL_TRIANGLES, 0, 6);
-
-	glEnable(GL_DEPTH_TEST);
-}
-
-void Renderer::resetRender() {
-	glBufferData(GL_ARRAY_BUFFER, data1.size() * sizeof(float), &data1[0], GL_STATIC_DRAW);
-
-	glUseProgram(shaderBuffer[1].getID());
-	glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[0].id, 1, GL_FALSE, &(glm::mat4(1.0f)[0][0]));
-	glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[1].id, 1, GL_FALSE, &(camera.getViewMatrix()[0][0]));
-	glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[2].id, 1, GL_FALSE, &(Projection[0][0]));
-	glUniform3f(shaderBuffer[1].getUniformBuffer()[3].id, 255, 255, 255);
-
-	glEnableVertexAttribArray(0);
-
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-	glDrawArrays(GL_LINES, 0, data1.size());
-
-	glDisableVertexAttribArray(0);
-}
-
-void Renderer::resizeScreen() {
-	// create an empty texture object for screenTexture, this texture will be bound to the screenFBO
-	// and will store the screen view image
-	glDeleteTextures(1, &this->screenTexture);
-	glGenTextures(1, &this->screenTexture);
-	// bind the screenTexture texture as the main texture
-	glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->screenTexture);
-
-	/* ACTIVE TEXTURE: screenTexture */
-
-	// create the actual texture for image with res: screenWidth x screenHeight
-	glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, samples, GL_RGB, screenWidth, screenHeight, false);
-
-
-	// set the texture filters for mipmaps
-	glDeleteTextures(1, &this->screenDepthTexture);
-	glGenTextures(1, &this->screenDepthTexture);
-	glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->screenDepthTexture);
-
-	glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, samples, GL_DEPTH_STENCIL, screenWidth, screenHeight, false);
-
-	glDeleteTextures(1, &this->outlineTextureMask);
-	glGenTextures(1, &this->outlineTextureMask);
-	glBindTexture(GL_TEXTURE_2D, this->outlineTextureMask);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, screenWidth, screenHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-
-	glDeleteTextures(1, &this->postProcessingTexture);
-	glGenTextures(1, &this->postProcessingTexture);
-	glBindTexture(GL_TEXTURE_2D, this->postProcessingTexture);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, screenWidth, screenHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-	glDeleteTextures(1, &this->postProcessingDepthTexture);
-	glGenTextures(1, &this->postProcessingDepthTexture);
-	glBindTexture(GL_TEXTURE_2D, this->postProcessingDepthTexture);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, screenWidth, screenHeight, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_BYTE, NULL);
-
-	glDeleteFramebuffers(1, &this->postProcessingFBO);
-	glGenFramebuffers(1, &this->postProcessingFBO);
-	glBindFramebuffer(GL_FRAMEBUFFER, this->postProcessingFBO);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, this->postProcessingTexture, 0);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, this->postProcessingDepthTexture, 0);
-
-	// create the screenFBO (used for rendering the screen view to a texture)
-	glDeleteFramebuffers(1, &this->screenFBO);
-	glGenFramebuffers(1, &this->screenFBO);
-	// bind the screenFBO to be the default FBO
-	glBindFramebuffer(GL_FRAMEBUFFER, this->screenFBO);
-
-	/* ACTIVE FRAMEBUFFER: screenFBO */
-
-	// attach the screenTexture to the screenFBO, so that the stuff rendered on the screenFBO can be saved to the screenTexture
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D_MULTISAMPLE, this->screenTexture, 0);
-	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D_MULTISAMPLE, this->screenDepthTexture, 0);
-
-	glViewport(0, 0, screenWidth, screenHeight);
-
-	projectionBuffer[0] = glm::perspective(glm::radians(45.0f), (float)screenWidth / (float)screenHeight, 0.1f, 10000.0f);
-	updated = true;
-}
-
-void Renderer::displayBoundingBox() {
-	for (int i = 0; i < entityBuffer.size(); i++) {
-		if (drawOBB) {
-			drawBoundingBox(entityBuffer[i]->getObjectBoundingBox(true), glm::vec3(1, 0, 0));
-		}
-
-		if (drawAABB1) {
-			drawBoundingBox(entityBuffer[i]->getExternalAxisAlignedBoundingBox(true), glm::vec3(0, 1, 0));
-		}
-
-		if (drawAABB2) {
-			drawBoundingBox(entityBuffer[i]->getInternalAxisAlignedBoundingBox(true), glm::vec3(0, 0, 1));
-		}
-
-		if (drawAABB3) {
-			bounds_t internalWorldBounds;
-			internalWorldBounds = entityBuffer[i]->getInternalAxisAlignedBoundingBox(true);
-
-			bounds_t worldBounds;
-			worldBounds = entityBuffer[i]->getExternalAxisAlignedBoundingBox(true);
-
-			std::vector<float> data5;
-
-			glm::vec3 a2 = glm::vec3((worldBounds.a.x + internalWorldBounds.a.x) / 2, (worldBounds.a.y + internalWorldBounds.a.y) / 2, (worldBounds.a.z + internalWorldBounds.a.z) / 2);
-			glm::vec3 b2 = glm::vec3((worldBounds.b.x + internalWorldBounds.b.x) / 2, (worldBounds.b.y + internalWorldBounds.b.y) / 2, (worldBounds.b.z + internalWorldBounds.b.z) / 2);
-			glm::vec3 c2 = glm::vec3((worldBounds.c.x + internalWorldBounds.c.x) / 2, (worldBounds.c.y + internalWorldBounds.c.y) / 2, (worldBounds.c.z + internalWorldBounds.c.z) / 2);
-			glm::vec3 d2 = glm::vec3((worldBounds.d.x + internalWorldBounds.d.x) / 2, (worldBounds.d.y + internalWorldBounds.d.y) / 2, (worldBounds.d.z + internalWorldBounds.d.z) / 2);
-			glm::vec3 e2 = glm::vec3((worldBounds.e.x + internalWorldBounds.e.x) / 2, (worldBounds.e.y + internalWorldBounds.e.y) / 2, (worldBounds.e.z + internalWorldBounds.e.z) / 2);
-			glm::vec3 f2 = glm::vec3((worldBounds.f.x + internalWorldBounds.f.x) / 2, (worldBounds.f.y + internalWorldBounds.f.y) / 2, (worldBounds.f.z + internalWorldBounds.f.z) / 2);
-			glm::vec3 g2 = glm::vec3((worldBounds.g.x + internalWorldBounds.g.x) / 2, (worldBounds.g.y + internalWorldBounds.g.y) / 2, (worldBounds.g.z + internalWorldBounds.g.z) / 2);
-			glm::vec3 h2 = glm::vec3((worldBounds.h.x + internalWorldBounds.h.x) / 2, (worldBounds.h.y + internalWorldBounds.h.y) / 2, (worldBounds.h.z + internalWorldBounds.h.z) / 2);
-
-			std::vector<glm::vec3> faces4;
-			faces4.push_back(a2);
-			faces4.push_back(b2);
-			faces4.push_back(c2);
-			faces4.push_back(d2);
-			faces4.push_back(e2);
-			faces4.push_back(f2);
-			faces4.push_back(g2);
-			faces4.push_back(h2);
-			createCube(&data5, faces4);
-			glBindBuffer(GL_ARRAY_BUFFER, tmpBuffer);
-			glBufferData(GL_ARRAY_BUFFER, data5.size() * sizeof(float), &data5[0], GL_STATIC_DRAW);
-
-			glUseProgram(shaderBuffer[1].getID());
-
-			glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[0].id, 1, GL_FALSE, &(glm::mat4(1.0f)[0][0]));
-			glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[1].id, 1, GL_FALSE, &(camera.getViewMatrix()[0][0]));
-			glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[2].id, 1, GL_FALSE, &(Projection[0][0]));
-			glUniform3f(shaderBuffer[1].getUniformBuffer()[3].id, 0, 1, 1);
-
-			glEnableVertexAttribArray(0);
-			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-			glPointSize(10.0f);
-
-			glDrawArrays(GL_LINES, 0, data5.size());
-
-			glDisableVertexAttribArray(0);
-		}
-
-		if (drawAABB4) {
-			drawBoundingBox(entityBuffer[i]->getAxisAlignedBoundingBox(true), glm::vec3(1, 0, 1));
-		}
-
-		if (drawBS) {
-			drawBoundingSphere(entityBuffer[i]->getInternalBoundingSphere(false), entityBuffer[i]->getWorldPosition(), glm::vec3(1, 1, 0));
-		}
-
-		if (drawBS2) {
-			drawBoundingSphere(entityBuffer[i]->getExternalBoundingSphere(false), entityBuffer[i]->getWorldPosition(), glm::vec3(1, 0.5, 0));
-		}
-
-		if (drawBS3) {
-			drawBoundingSphere(entityBuffer[i]->getBoundingSphere(false), entityBuffer[i]->getWorldPosition(), glm::vec3(0.5, 1, 0));
-		}
-	}
-}
-
-
-void Renderer::setHighlightedEntity(int index) {
-	this->highlightedEntity = index;
-}
-
-// pass the correct values to the corresponding uniforms in the shader
-void Renderer::attachUniforms(Entity* entity, std::vector<uniform_t> uniformBuffer) {
-	// cycle through the uniformBuffer of the shader
-	for (int i = 0; i < uniformBuffer.size(); i++) {
-		// if the uniform is "modelMatrix", set it to the entity modelMatrix
-		if (strcmp(uniformBuffer[i].name, "modelMatrix") == 0) {
-			glUniformMatrix4fv(uniformBuffer[i].id, 1, GL_FALSE, &(entity->getModelMatrix()[0][0]));
-		}
-
-		// if the uniform is "viewMatrix", set it to the camera viewMatrix
-		else if (strcmp(uniformBuffer[i].name, "viewMatrix") == 0) {
-			// if the entity we're rendering is the skybox, 
-			if (entity->getName().compare("skybox") == 0) {
-				// this process removes all the translations from the camera, this way camera movement is not taken into account
-				glm::mat4 staticCameraView = glm::mat4(glm::mat3(cameraBuffer[defaultCamera]->getViewMatrix()));
-				glUniformMatrix4fv(uniformBuffer[i].id, 1, GL_FALSE, &(staticCameraView[0][0]));
-			}
-			// otherwise pass the camera view matrix, including all translations
-			else {
-				glUniformMatrix4fv(uniformBuffer[i].id, 1, GL_FALSE, &(cameraBuffer[defaultCamera]->getViewMatrix()[0][0]));
-			}
-		}
-
-		// if the uniform is "projectionMatrix", set it to the main camera projection matrix in the projectionBuffer
-		else if (strcmp(uniformBuffer[i].name, "projectionMatrix") == 0) {
-			glUniformMatrix4fv(uniformBuffer[i].id, 1, GL_FALSE, &(projectionBuffer[defaultCamera][0][0]));
-		}
-
-		// if the uniform is "lightPosition", pass the light position (x, y, z)
-		else if (strcmp(uniformBuffer[i].name, "lightPosition") == 0) {
-			glUniform3f(uniformBuffer[i].id, light->getWorldPosition().x, light->getWorldPosition().y, light->getWorldPosition().z);
-		}
-
-		// if the uniform is "eyePosition", pass the camera position (x, y, z)
-		else if (strcmp(uniformBuffer[i].name, "eyePosition") == 0) {
-			glUniform3f(uniformBuffer[i].id, cameraBuffer[defaultCamera]->getPosition().x, cameraBuffer[defaultCamera]->getPosition().y, cameraBuffer[defaultCamera]->getPosition().z);
-		}
-	}
-}
-
-// link layouts to the data origin (mainly VAO)
-void Renderer::linkLayouts(Entity* entity, std::vector<char*> layoutBuffer) {
-	// cycle all the layouts in the layout buffer of the shader
-	for (int i = 0; i < layoutBuffer.size(); i++) {
-		// if the layout is named "vertex" (contains the entity vertices that make the geometry of the entity)
-		if (strcmp(layoutBuffer[i], "vertex") == 0) {
-			// enable the VAO in position 0
-			glEnableVertexAttribArray(0);
-			// bind the geometry VBO of the entity
-			glBindBuffer(GL_ARRAY_BUFFER, entity->getVertexBuffer());
-			// setup the VAO to reference the VBO (needs more study)
-			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-		}
-		// if the layout is named "uv" (contains the UV coordinates to map the texture to the geometry)
-		else if (strcmp(layoutBuffer[i], "uv") == 0) {
-			// enable the VAO in position 1
-			glEnableVertexAttribArray(1);
-			// bind the UV VBO of the entity
-			glBindBuffer(GL_ARRAY_BUFFER, entity->getTexBuffer());
-			// setup the VAO to reference the VBO (needs more study)
-			glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
-		}
-		// if the layout is named "color" (contains the color vectors that make the entity color)
-		else if (strcmp(layoutBuffer[i], "color") == 0) {
-			// enable the VAO in position 1
-			glEnableVertexAttribArray(1);
-			// bind the color VBO of the entity
-			glBindBuffer(GL_ARRAY_BUFFER, entity->getTexBuffer());
-			// setup the VAO to reference the VBO (needs more study)
-			glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-		}
-		// if the layout is named "normal" (contains the normals to the vertices, used for light calculation)
-		else if (strcmp(layoutBuffer[i], "normal") == 0) {
-			// enable the VAO in position 1
-			glEnableVertexAttribArray(2);
-			// bind the normal VBO of the entity
-			glBindBuffer(GL_ARRAY_BUFFER, entity->getNormalBuffer());
-			// setup the VAO to reference the VBO (needs more study)
-			glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-		}
-	}
-}
-
-void Renderer::createCube(std::vector<float>* array, std::vector<glm::vec3> faces) {
-	array->push_back(faces[0].x);
-	array->push_back(faces[0].y);
-	array->push_back(faces[0].z);
-	array->push_back(faces[1].x);
-	array->push_back(faces[1].y);
-	array->push_back(faces[1].z);
-
-	array->push_back(faces[1].x);
-	array->push_back(faces[1].y);
-	array->push_back(faces[1].z);
-	array->push_back(faces[2].x);
-	array->push_back(faces[2].y);
-	array->push_back(faces[2].z);
-
-	array->push_back(faces[2].x);
-	array->push_back(faces[2].y);
-	array->push_back(faces[2].z);
-	array->push_back(faces[3].x);
-	array->push_back(faces[3].y);
-	array->push_back(faces[3].z);
-
-	array->push_back(faces[3].x);
-	array->push_back(faces[3].y);
-	array->push_back(faces[3].z);
-	array->push_back(faces[0].x);
-	array->push_back(faces[0].y);
-	array->push_back(faces[0].z);
-
-	array->push_back(faces[0].x);
-	array->push_back(faces[0].y);
-	array->push_back(faces[0].z);
-	array->push_back(faces[5].x);
-	array->push_back(faces[5].y);
-	array->push_back(faces[5].z);
-
-	array->push_back(faces[1].x);
-	array->push_back(faces[1].y);
-	array->push_back(faces[1].z);
-	array->push_back(faces[6].x);
-	array->push_back(faces[6].y);
-	array->push_back(faces[6].z);
-
-	array->push_back(faces[2].x);
-	array->push_back(faces[2].y);
-	array->push_back(faces[2].z);
-	array->push_back(faces[7].x);
-	array->push_back(faces[7].y);
-	array->push_back(faces[7].z);
-
-	array->push_back(faces[3].x);
-	array->push_back(faces[3].y);
-	array->push_back(faces[3].z);
-	array->push_back(faces[4].x);
-	array->push_back(faces[4].y);
-	array->push_back(faces[4].z);
-
-	array->push_back(faces[5].x);
-	array->push_back(faces[5].y);
-	array->push_back(faces[5].z);
-	array->push_back(faces[4].x);
-	array->push_back(faces[4].y);
-	array->push_back(faces[4].z);
-
-	array->push_back(faces[4].x);
-	array->push_back(faces[4].y);
-	array->push_back(faces[4].z);
-	array->push_back(faces[7].x);
-	array->push_back(faces[7].y);
-	array->push_back(faces[7].z);
-
-	array->push_back(faces[7].x);
-	array->push_back(faces[7].y);
-	array->push_back(faces[7].z);
-	array->push_back(faces[6].x);
-	array->push_back(faces[6].y);
-	array->push_back(faces[6].z);
-
-	array->push_back(faces[6].x);
-	array->push_back(faces[6].y);
-	array->push_back(faces[6].z);
-	array->push_back(faces[5].x);
-	array->push_back(faces[5].y);
-	array->push_back(faces[5].z);
-}
-
-void Renderer::createSphere(glm::vec3 center, float dist, int sides, std::vector<float>* data) {
-
-	double pi = 3.1415926535897;
-
-	glm::vec3 tmp;
-
-	glm::vec3 tmp2;
-
-	tmp = glm::vec3(dist, 0, 0) + center;
-
-	for (float i = 0; i < 2 * pi; i += (2 * pi) / (float)sides) {
-		tmp2.x = dist * cos(i);
-		tmp2.y = dist * sin(i);
-		tmp2.z = 0;
-
-		data->push_back(tmp.x);
-		data->push_back(tmp.y);
-		data->push_back(tmp.z);
-
-		tmp = tmp2 + center;
-
-		data->push_back(tmp.x);
-		data->push_back(tmp.y);
-		data->push_back(tmp.z);
-	}
-
-	data->push_back(tmp.x);
-	data->push_back(tmp.y);
-	data->push_back(tmp.z);
-
-	tmp = glm::vec3(dist, 0, 0) + center;
-
-	data->push_back(tmp.x);
-	data->push_back(tmp.y);
-	data->push_back(tmp.z);
-
-
-
-	tmp = glm::vec3(0, 0, dist) + center;
-
-	for (float i = 0; i < 2 * pi; i += (2 * pi) / (float)sides) {
-		tmp2.x = 0;
-		tmp2.y = dist * sin(i);
-		tmp2.z = dist * cos(i);
-
-		data->push_back(tmp.x);
-		data->push_back(tmp.y);
-		data->push_back(tmp.z);
-
-		tmp = tmp2 + center;
-
-		data->push_back(tmp.x);
-		data->push_back(tmp.y);
-		data->push_back(tmp.z);
-	}
-
-	data->push_back(tmp.x);
-	data->push_back(tmp.y);
-	data->push_back(tmp.z);
-
-	tmp = glm::vec3(0, 0, dist) + center;
-
-	data->push_back(tmp.x);
-	data->push_back(tmp.y);
-	data->push_back(tmp.z);
-
-
-
-	tmp = glm::vec3(0, 0, dist) + center;
-
-	for (float i = 0; i < 2 * pi; i += (2 * pi) / (float)sides) {
-		tmp2.x = dist * sin(i);
-		tmp2.y = 0;
-		tmp2.z = dist * cos(i);
-
-		data->push_back(tmp.x);
-		data->push_back(tmp.y);
-		data->push_back(tmp.z);
-
-		tmp = tmp2 + center;
-
-		data->push_back(tmp.x);
-		data->push_back(tmp.y);
-		data->push_back(tmp.z);
-	}
-
-	data->push_back(tmp.x);
-	data->push_back(tmp.y);
-	data->push_back(tmp.z);
-
-	tmp = glm::vec3(0, 0, dist) + center;
-
-	data->push_back(tmp.x);
-	data->push_back(tmp.y);
-	data->push_back(tmp.z);
-}
-
-void Renderer::drawBoundingBox(bounds_t bounds, glm::vec3 color) {
-	std::vector<float> data;
-	std::vector<glm::vec3> faces;
-	faces.push_back(bounds.a);
-	faces.push_back(bounds.b);
-	faces.push_back(bounds.c);
-	faces.push_back(bounds.d);
-	faces.push_back(bounds.e);
-	faces.push_back(bounds.f);
-	faces.push_back(bounds.g);
-	faces.push_back(bounds.h);
-	createCube(&data, faces);
-
-	glBindBuffer(GL_ARRAY_BUFFER, tmpBuffer);
-	glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), &data[0], GL_STATIC_DRAW);
-
-	glUseProgram(shaderBuffer[1].getID());
-
-	glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[0].id, 1, GL_FALSE, &(glm::mat4(1.0f)[0][0]));
-	glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[1].id, 1, GL_FALSE, &(camera.getViewMatrix()[0][0]));
-	glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[2].id, 1, GL_FALSE, &(projectionBuffer[0][0][0]));
-	glUniform3f(shaderBuffer[1].getUniformBuffer()[3].id, color.x, color.y, color.z);
-
-	glEnableVertexAttribArray(0);
-	// glBindBuffer(GL_ARRAY_BUFFER, tmpBuffer2);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-	glDrawArrays(GL_LINES, 0, data.size());
-
-	glDisableVertexAttribArray(0);
-}
-
-void Renderer::drawBoundingSphere(float radius, glm::vec3 center, glm::vec3 color) {
-	std::vector<float> data;
-
-	createSphere(center, radius, 100, &data);
-	glBindBuffer(GL_ARRAY_BUFFER, tmpBuffer);
-	glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), &data[0], GL_STATIC_DRAW);
-
-	glUseProgram(shaderBuffer[1].getID());
-
-	glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[0].id, 1, GL_FALSE, &(glm::mat4(1.0f)[0][0]));
-	glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[1].id, 1, GL_FALSE, &(camera.getViewMatrix()[0][0]));
-	glUniformMatrix4fv(shaderBuffer[1].getUniformBuffer()[2].id, 1, GL_FALSE, &(Projection[0][0]));
-	glUniform3f(shaderBuffer[1].getUniformBuffer()[3].id, color.x, color.y, color.z);
-
-	glEnableVertexAttribArray(0);
-
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-	glDrawArrays(GL_LINES, 0, data.size());
-
-	glDisableVertexAttribArray(0);
-}
-
-
-
-double Renderer::getReflectionRenderTime() {
-	return(this->reflectionRenderTime);
-}
-
-double Renderer::getForwardRenderTime() {
-	return(this->forwardRenderTime);
-}
-
-double Renderer::getMSPostProcessingPassTime() {
-	return(this->MSPostProcessingPassTime);
-}
-
-double Renderer::getPostProcessingPassTime() {
-	return(this->postProcessingPassTime);
-}
-
-unsigned int Renderer::getOutlineMaskTexture() {
-	return(this->outlineTextureMask);
-}
-
-unsigned int Renderer::getDepthBufferTexture() {
-	bool tmpVar = depthBuffer;
-
-	depthBuffer = true;
-	this->renderMultisamplePostProcessing();
-	depthBuffer = tmpVar;
-
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-	return(this->postProcessingTexture);
-}
-
+#include "renderer.h"
+#include "entity.h"
+#include "camera.h"
+#include "shader.h"
+#include <vector>
+#include <glad\glad.h>
+#include <glm\glm.hpp>
+#include <glm\gtc\matrix_transform.hpp>
+#include <glm\gtc\type_ptr.hpp>
+#include <SFML\Graphics.hpp>
+#include "init.h"
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <math.h>
+
+// constructor method, sets up the renderer (reflection and post processing)
+Renderer::Renderer() {
+	// sets the color to clear the color buffer with
+	glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+
+	// enable multisampling
+	glState->enable(GL_MULTISAMPLE);
+
+	// the anti-aliasing mode decides how many samples the forward pass targets have, never more than the GPU supports
+	glGetIntegerv(GL_MAX_SAMPLES, &this->maxSamples);
+	printf("max samples: %d\n", this->maxSamples);
+	samples = this->getAntiAliasingSamples();
+	glState->enable(GL_STENCIL_TEST);
+
+	// the GPU times come from the render graph timer, a few frames after they were drawn
+	this->cpuFrameTime = 0.0;
+	this->scaledFrame = -1;
+	this->forwardFrame = -1;
+
+	for (int i = 0; i < GPU_TIMER_FRAMES; i++) {
+		this->forwardPaths[i] = 0;
+	}
+
+	for (int i = 0; i < 2; i++) {
+		this->forwardGPUTime[i] = 0.0;
+		this->forwardCPUTime[i] = 0.0;
+	}
+
+	this->pulling = false;
+	this->renderWidth = screenWidth;
+	this->renderHeight = screenHeight;
+	// the first frame allocates the targets
+	this->targetWidth = 0;
+	this->targetHeight = 0;
+	this->resizeTime = 0.0;
+
+	// enables back-face culling:
+	// polygons aren't rendered if the vertices that define the triangle are seen clockwise or counterclockwise,
+	// a face with vertices indexed in the opposite order suggest that it's being viewed from the other side,
+	// which is usually the inside of the model, which doesn't need to be rendered
+	glState->enable(GL_CULL_FACE);
+	glCullFace(GL_BACK);
+
+	// generate 1 generic buffer and assigns its ID to the variable tmpBuffer
+	glGenBuffers(1, &this->tmpBuffer);
+
+
+	/*--------------------------------------------------------------------------*/
+	/*                             REFLECTION SETUP                             */
+	/*--------------------------------------------------------------------------*/
+
+	// defines the resolution of the reflection cubemap
+	this->reflectionRes = 2048;
+
+	// generate the framebuffer that is gonna store the view from the reflection camera
+	this->reflectionFBO = glState->createFramebuffer();
+
+	// immutable RGB cubemap with a single level, its faces are attached to the framebuffer one at a time while rendering
+	this->reflectionCubemap = glState->createTexture(GL_TEXTURE_CUBE_MAP, GL_RGB8, this->reflectionRes, this->reflectionRes, 1, 0);
+	// linear filtering, clamped to the edge of each face in the S, T and R axis
+	glState->setTextureSampler(this->reflectionCubemap, glState->getSampler(GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE));
+
+	// generates one render buffer to attach to the framebuffer to store the depth and stencil (more optimized than textures for targets)
+	this->reflectionRBO = glState->createRenderbuffer(GL_DEPTH24_STENCIL8, 8, this->reflectionRes, this->reflectionRes);
+	// attach renderBuffer to the reflection framebuffer
+	glState->framebufferRenderbuffer(this->reflectionFBO, GL_DEPTH_STENCIL_ATTACHMENT, this->reflectionRBO);
+
+
+	/*-------------------------------------------------------------------------------*/
+	/*                             POST PROCESSING SETUP                             */
+	/*-------------------------------------------------------------------------------*/
+	
+	// the screen sized targets come from the render graph, which creates them the first frame they're used
+	// and hands them out again when the resolution or the enabled passes change
+	this->renderGraph = new RenderGraph();
+
+	this->screenFBO = 0;
+	this->screenTexture = 0;
+	this->screenDepthTexture = 0;
+	this->postProcessingFBO = 0;
+	this->postProcessingTexture = 0;
+	this->postProcessingDepthFBO = 0;
+	this->postProcessingDepthTexture = 0;
+
+	// create a square of vertices for the post processing shader
+	std::vector<float> square;
+	square.push_back(-1.0f); // bottom-left
+	square.push_back(1.0f);
+
+	square.push_back(-1.0f); // top-left
+	square.push_back(-1.0f);
+
+	square.push_back(1.0f); //  top-right
+	square.push_back(-1.0f);
+
+
+	square.push_back(-1.0f); // bottom-left
+	square.push_back(1.0f);
+
+	square.push_back(1.0f); //  top-right
+	square.push_back(-1.0f);
+
+	square.push_back(1.0f); //  bottom-right
+	square.push_back(1.0f);
+
+	// create the immutable VBO storing the square vertices
+	this->screenVBO = glState->createBuffer(square.size() * sizeof(float), &square[0], 0);
+
+	// create the UV coordinates to map the screen texture to the screen square
+	std::vector<float> uv;
+	uv.push_back(0.0f); // bottom-left
+	uv.push_back(1.0f);
+
+	uv.push_back(0.0f); // top-left
+	uv.push_back(0.0f);
+
+	uv.push_back(1.0f); // top-right
+	uv.push_back(0.0f);
+
+
+	uv.push_back(0.0f); // bottom-left
+	uv.push_back(1.0f);
+
+	uv.push_back(1.0f); // top-right
+	uv.push_back(0.0f);
+
+	uv.push_back(1.0f); // bottom-right
+	uv.push_back(1.0f);
+
+	// create the immutable VBO storing the UV coordinates
+	this->screenUVVBO = glState->createBuffer(uv.size() * sizeof(float), &uv[0], 0);
+
+	// the multisample resolve and depth buffer display shaders, the variant for the current sample count is compiled now
+	// and the others the first time the anti-aliasing mode asks for them
+	this->screenShaders = new ShaderVariants((char*)"screen shader", (char*)"../Shader/screen/screen.vert", (char*)"../Shader/screen/screen.frag");
+	this->depthShaders = new ShaderVariants((char*)"depth shader", (char*)"../Shader/depth/depth.vert", (char*)"../Shader/depth/depth.frag");
+	this->screenShaders->getVariant("SAMPLES", samples);
+
+	// the entity shaders are compiled in the background, this one is waited on so there's always something to draw with
+	this->fallbackShader = new Shader((char*)"fallback shader");
+	this->fallbackShader->loadShader((char*)"../Shader/lightSource/lightSourceVertex.c", (char*)"../Shader/fallback/fallback.frag");
+
+	this->postProcessingShader = new Shader((char*)"post-processing shader");
+	this->postProcessingShader->loadShader((char*)"../Shader/postProcessing/postProcessing.vert", (char*)"../Shader/postProcessing/postProcessing.frag");
+
+	/*-------------------------------------------------------------------------------------------*/
+	/*                             SCREEN SPACE REFLECTION SETUP                                 */
+	/*-------------------------------------------------------------------------------------------*/
+
+	this->hiZFBO = 0;
+	this->hiZTexture = 0;
+	this->hiZLevels = 1;
+	this->ssrNormalFBO = 0;
+	this->ssrNormalTexture = 0;
+	this->ssrFBO = 0;
+	this->ssrTexture = 0;
+
+	this->velocityFBO = 0;
+	this->velocityTexture = 0;
+	this->taaFBO[0] = 0;
+	this->taaFBO[1] = 0;
+	this->taaTexture[0] = 0;
+	this->taaTexture[1] = 0;
+	this->taaCurrent = 0;
+	this->taaHistoryValid = false;
+	this->jitterIndex = 0;
+	this->jitter = glm::vec2(0.0f);
+	this->projection = projectionBuffer[0];
+	this->previousViewProjection = glm::mat4(1.0f);
+
+	this->upscaleFBO = 0;
+	this->upscaleTexture = 0;
+
+	this->outlineFBO[0] = 0;
+	this->outlineFBO[1] = 0;
+	this->outlineTexture[0] = 0;
+	this->outlineTexture[1] = 0;
+
+	this->debugDraw = new DebugDraw();
+	this->drawProfiler = new DrawProfiler();
+	this->frameStats = new FrameStats();
+	this->materials = new MaterialTextures();
+	this->meshPool = new MeshPool();
+
+	// user configurable effects drawn on the final image
+	this->postProcessing = new PostProcessing(this->screenVBO, this->screenUVVBO, this->renderGraph->getTimer());
+
+	// outline of the selected entity: seeds from the stencil ids, jump flood steps and the final composite
+	this->outlineSeedShader = new Shader((char*)"outline seed shader");
+	this->outlineSeedShader->loadShader((char*)"../Shader/outline/outline.vert", (char*)"../Shader/outline/seed.frag");
+	this->jumpFloodShader = new Shader((char*)"jump flood shader");
+	this->jumpFloodShader->loadShader((char*)"../Shader/outline/outline.vert", (char*)"../Shader/outline/jumpFlood.frag");
+	this->outlineShaders = new ShaderVariants((char*)"outline shader", (char*)"../Shader/outline/outline.vert", (char*)"../Shader/outline/outline.frag");
+
+	// builds the hierarchical depth mip chain
+	this->hiZShader = new Shader((char*)"hi-z shader");
+	this->hiZShader->loadShader((char*)"../Shader/ssr/quad.vert", (char*)"../Shader/ssr/hiz.frag");
+
+	// writes the view space normals and reflectivity of the surfaces that receive screen space reflections
+	this->ssrNormalShader = new Shader((char*)"ssr normal shader");
+	this->ssrNormalShader->loadShader((char*)"../Shader/ssr/normal.vert", (char*)"../Shader/ssr/normal.frag");
+
+	// traces the reflected rays against the hierarchical depth at half resolution
+	this->ssrShader = new Shader((char*)"ssr shader");
+	this->ssrShader->loadShader((char*)"../Shader/ssr/quad.vert", (char*)"../Shader/ssr/ssr.frag");
+
+	// depth aware upsample of the reflections on top of the resolved image
+	this->ssrCompositeShader = new Shader((char*)"ssr composite shader");
+	this->ssrCompositeShader->loadShader((char*)"../Shader/ssr/quad.vert", (char*)"../Shader/ssr/composite.frag");
+
+	// edge smoothing applied in the final screen pass when no multisampling is used
+	this->fxaaShader = new Shader((char*)"fxaa shader");
+	this->fxaaShader->loadShader((char*)"../Shader/fxaa/fxaa.vert", (char*)"../Shader/fxaa/fxaa.frag");
+
+	// writes the screen motion of the entities that moved since the last frame
+	this->motionShader = new Shader((char*)"motion shader");
+	this->motionShader->loadShader((char*)"../Shader/taa/motion.vert", (char*)"../Shader/taa/motion.frag");
+
+	// blends the jittered frame into the reprojected history
+	this->taaShader = new Shader((char*)"taa shader");
+	this->taaShader->loadShader((char*)"../Shader/taa/taa.vert", (char*)"../Shader/taa/taa.frag");
+
+	// edge adaptive upsample of the reduced resolution image and the contrast adaptive sharpening after it
+	this->upscaleShader = new Shader((char*)"upscale shader");
+	this->upscaleShader->loadShader((char*)"../Shader/upscale/upscale.vert", (char*)"../Shader/upscale/upscale.frag");
+
+	this->sharpenShader = new Shader((char*)"sharpen shader");
+	this->sharpenShader->loadShader((char*)"../Shader/upscale/upscale.vert", (char*)"../Shader/upscale/sharpen.frag");
+
+	// the entity shaders and the renderer ones are compiled again when their files change
+	this->shaderReloader = new ShaderReloader();
+
+	for (int i = 0; i < shaderBuffer.size(); i++) {
+		this->shaderReloader->watch(&shaderBuffer[i]);
+	}
+
+	Shader* rendererShaders[] = {
+		this->postProcessingShader, this->fallbackShader, this->fxaaShader, this->hiZShader, this->ssrNormalShader,
+		this->ssrShader, this->ssrCompositeShader, this->motionShader, this->taaShader, this->upscaleShader,
+		this->sharpenShader, this->outlineSeedShader, this->jumpFloodShader
+	};
+
+	for (int i = 0; i < sizeof(rendererShaders) / sizeof(Shader*); i++) {
+		this->shaderReloader->watch(rendererShaders[i]);
+	}
+}
+
+// public method for rendering the scene
+void Renderer::render() {
+	PROFILE_ZONE("Renderer::render");
+
+	double frameStart = glfwGetTime();
+
+	// the ui and the loading code change bindings without going through the state cache
+	glState->beginFrame();
+
+	// pick up the entity shaders the driver finished compiling since the last frame, and the reloaded ones
+	for (int i = 0; i < shaderBuffer.size(); i++) {
+		shaderBuffer[i].poll();
+	}
+
+	// the renderer shaders are loaded in the constructor, the setup time is known once the entity ones are done too
+	if (!shaderCache->isReported()) {
+		bool compiled = true;
+
+		for (int i = 0; i < shaderBuffer.size(); i++) {
+			compiled = compiled && shaderBuffer[i].isReady();
+		}
+
+		if (compiled) {
+			shaderCache->report();
+		}
+	}
+
+	this->shaderReloader->update();
+
+	// switching anti-aliasing mode changes the sample count of the forward pass targets, which the render graph
+	// picks up when they're declared
+	samples = this->getAntiAliasingSamples();
+
+	if (updateResolution) {
+		this->resizeScreen();
+	}
+
+	this->updateTargetSize();
+
+	// pick the resolution of this frame, the targets keep their size and only the bottom left part is rendered to
+	this->updateRenderScale();
+	this->readForwardTime();
+
+	// the benchmark alternates the paths, so both are measured under the same conditions
+	this->pulling = vertexPullingBenchmark ? this->renderGraph->getTimer()->getFrameCount() % 2 == 1 : vertexPulling;
+	this->pulling = this->pulling && this->meshPool->isAvailable();
+	this->forwardPaths[this->renderGraph->getTimer()->getFrameCount() % GPU_TIMER_FRAMES] = this->pulling;
+
+	// temporal anti-aliasing moves the image by a different sub-pixel offset every frame, the unjittered
+	// projection is put back at the end of the frame
+	this->projection = projectionBuffer[0];
+
+	if (antiAliasing == taa) {
+		this->jitterIndex = (this->jitterIndex + 1) % 8;
+		this->jitter = glm::vec2(this->halton(this->jitterIndex + 1, 2) - 0.5f, this->halton(this->jitterIndex + 1, 3) - 0.5f);
+
+		glm::vec3 offset = glm::vec3(2.0f * this->jitter.x / this->renderWidth, 2.0f * this->jitter.y / this->renderHeight, 0.0f);
+		projectionBuffer[0] = glm::translate(glm::mat4(1.0f), offset) * this->projection;
+	}
+	else {
+		this->jitter = glm::vec2(0.0f);
+		this->taaHistoryValid = false;
+	}
+
+	// the passes that contribute to the screen are drawn into targets assigned by the graph
+	this->buildRenderGraph();
+	this->drawProfiler->beginFrame();
+	this->renderGraph->execute();
+	this->drawProfiler->endFrame();
+
+
+	// what the next frame reprojects from
+	projectionBuffer[0] = this->projection;
+	this->previousViewProjection = this->projection * cameraBuffer[0]->getViewMatrix();
+
+	for (int i = 0; i < entityBuffer.size(); i++) {
+		entityBuffer[i]->updatePreviousModelMatrix();
+	}
+
+	this->cpuFrameTime = glfwGetTime() - frameStart;
+	this->frameStats->record(this->cpuFrameTime, this->renderGraph->getTimer());
+}
+
+// describe the frame as passes reading and writing targets: the passes whose results don't reach the screen (or the
+// history of the next frame) are culled, then every target that's still used gets a texture from the pool, shared
+// with the targets of the same kind whose lifetimes don't overlap
+void Renderer::buildRenderGraph() {
+	PROFILE_ZONE("Renderer::buildRenderGraph");
+
+	int seedWidth = (this->targetWidth + OUTLINE_DOWNSAMPLE - 1) / OUTLINE_DOWNSAMPLE;
+	int seedHeight = (this->targetHeight + OUTLINE_DOWNSAMPLE - 1) / OUTLINE_DOWNSAMPLE;
+	int next = 1 - this->taaCurrent;
+
+	this->hiZLevels = 1 + (int)floor(log2((double)std::max(this->targetWidth, this->targetHeight)));
+
+	RenderGraph* graph = this->renderGraph;
+	graph->reset();
+
+	// ------------------------------------------ TARGETS ----------------------------------------- //
+
+	int sceneColor = graph->createTexture("scene color", GL_RGB8, this->targetWidth, this->targetHeight, samples, 1, false);
+	int sceneDepth = graph->createTexture("scene depth", GL_DEPTH24_STENCIL8, this->targetWidth, this->targetHeight, samples, 1, false);
+	// same format as sceneColor for the hardware resolve, filtered linearly for FXAA
+	int resolvedColor = graph->createTexture("resolved color", GL_RGB8, this->targetWidth, this->targetHeight, 0, 1, true);
+	int resolvedDepth = graph->createTexture("resolved depth", GL_DEPTH24_STENCIL8, this->targetWidth, this->targetHeight, 0, 1, false);
+	// closest depth per texel of every mip, down to 1x1
+	int hiZ = graph->createTexture("hi-z", GL_R32F, this->targetWidth, this->targetHeight, 0, this->hiZLevels, false);
+	// view space normals (rgb) and reflectivity (a) of the reflective surfaces
+	int ssrNormal = graph->createTexture("ssr normals", GL_RGBA16F, this->targetWidth, this->targetHeight, 0, 1, false);
+	// half resolution reflection colors (rgb) and reflectivity (a)
+	int ssrColor = graph->createTexture("ssr color", GL_RGBA16F, this->targetWidth / 2, this->targetHeight / 2, 0, 1, false);
+	// screen motion of the moving entities, in uv units
+	int velocity = graph->createTexture("velocity", GL_RG16F, this->targetWidth, this->targetHeight, 0, 1, false);
+	int outlineSeed[2];
+	outlineSeed[0] = graph->createTexture("outline seeds 0", GL_RG16I, seedWidth, seedHeight, 0, 1, false);
+	outlineSeed[1] = graph->createTexture("outline seeds 1", GL_RG16I, seedWidth, seedHeight, 0, 1, false);
+	int upscaled = graph->createTexture("upscaled", GL_RGB8, this->targetWidth, this->targetHeight, 0, 1, false);
+
+	renderTargetDesc_t desc;
+	desc.samples = 0;
+	desc.levels = 1;
+	desc.linear = true;
+
+	desc.format = GL_RGB8;
+	desc.width = this->reflectionRes;
+	desc.height = this->reflectionRes;
+	desc.layers = 6;
+	int cubemap = graph->importTexture("reflection cubemap", this->reflectionCubemap, desc, false);
+
+	desc.format = GL_DEPTH24_STENCIL8;
+	desc.samples = 8;
+	desc.layers = 1;
+	int cubemapDepth = graph->importTexture("reflection depth", this->reflectionRBO, desc, false);
+
+	// the history written this frame is read by the next one, so it's an output like the screen
+	desc.format = GL_RGBA16F;
+	desc.width = this->targetWidth;
+	desc.height = this->targetHeight;
+	desc.samples = 0;
+	int history = graph->importTexture("taa history", this->taaTexture[this->taaCurrent], desc, false);
+	int taaOutput = graph->importTexture("taa output", this->taaTexture[next], desc, true);
+
+	desc.format = GL_RGBA8;
+	desc.layers = 2;
+	int postProcessingTargets = graph->importTexture("post processing targets", this->postProcessing->getInputTexture(), desc, false);
+
+	desc.layers = 1;
+	int screen = graph->importTexture("screen", 0, desc, true);
+
+	// ------------------------------------------- PASSES ----------------------------------------- //
+
+	graph->addPass("Reflection Cubemap", {}, { cubemap, cubemapDepth }, doReflection, [this]() {
+		glState->bindFramebuffer(GL_FRAMEBUFFER, this->reflectionFBO);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		// render the reflection cubemap
+		this->renderReflectionCubemap();
+	});
+
+	graph->addPass("Forward", { cubemap }, { sceneColor, sceneDepth }, true, [this]() {
+		glState->bindFramebuffer(GL_FRAMEBUFFER, this->screenFBO);
+		glState->viewport(0, 0, this->renderWidth, this->renderHeight);
+		glState->enable(GL_STENCIL_TEST);
+		glStencilOp(GL_KEEP,	   // stencil fail
+					GL_KEEP,	   // stencil pass, depth fail
+					GL_REPLACE);   // stencil pass, depth pass
+
+		glState->stencilMask(0xFF);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+		this->renderGraph->getTimer()->begin("Forward Entities");
+		this->renderEntities(false);
+		this->renderGraph->getTimer()->end();
+
+		// draw the bounding box for each entity
+		this->displayBoundingBox();
+	});
+
+	// the resolve and the depth view write the same target, only one of them is enabled
+	graph->addPass("Resolve", { sceneColor }, { resolvedColor }, !depthBuffer, [this]() {
+		this->renderMultisamplePostProcessing();
+	});
+
+	graph->addPass("Depth View", { sceneDepth }, { resolvedColor }, depthBuffer, [this]() {
+		this->renderMultisamplePostProcessing();
+	});
+
+	// shared by the screen space reflections and the temporal anti-aliasing, culled when neither runs
+	graph->addPass("Depth Resolve", { sceneDepth }, { resolvedDepth }, true, [this]() {
+		this->resolveDepth();
+	});
+
+	// screen space reflections need the resolved colors, so they're skipped while looking at the depth buffer
+	graph->addPass("Screen Space Reflections", { resolvedColor, resolvedDepth }, { resolvedColor, hiZ, ssrNormal, ssrColor },
+		doScreenSpaceReflection && !depthBuffer, [this]() {
+		this->renderScreenSpaceReflection();
+	});
+
+	graph->addPass("Outline", { resolvedColor, sceneDepth }, { resolvedColor, outlineSeed[0], outlineSeed[1] },
+		this->highlightedEntity >= 0 && this->highlightedEntity < OUTLINE_STENCIL_IDS && (outlineType == 0 || outlineType == 1), [this]() {
+		this->renderOutline();
+	});
+
+	graph->addPass("Temporal Anti-Aliasing", { resolvedColor, resolvedDepth, history }, { velocity, taaOutput }, antiAliasing == taa, [this]() {
+		this->renderTemporalAntiAliasing();
+	});
+
+	graph->addPass("Upscale", { resolvedColor }, { upscaled }, this->isUpscaling(), [this]() {
+		this->renderUpscale();
+	});
+
+	// the temporal anti-aliasing and upscaler outputs replace the resolved image
+	int source = resolvedColor;
+
+	if (antiAliasing == taa) {
+		source = taaOutput;
+	}
+	else if (this->isUpscaling()) {
+		source = upscaled;
+	}
+
+	graph->addPass("Screen", { source }, { screen, postProcessingTargets }, true, [this]() {
+		glState->bindFramebuffer(GL_FRAMEBUFFER, 0);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+		this->renderScreen();
+	});
+
+	graph->compile();
+
+	// ------------------------------------- TARGET ASSIGNMENT ------------------------------------ //
+
+	this->screenTexture = graph->getTexture(sceneColor);
+	this->screenDepthTexture = graph->getTexture(sceneDepth);
+	this->screenFBO = graph->getFramebuffer(this->screenTexture, this->screenDepthTexture);
+
+	this->postProcessingTexture = graph->getTexture(resolvedColor);
+	this->postProcessingFBO = graph->getFramebuffer(this->postProcessingTexture, 0);
+
+	// the passes drawing the surfaces again test them against the resolved depth
+	this->postProcessingDepthTexture = graph->getTexture(resolvedDepth);
+
+	if (this->postProcessingDepthTexture != 0) {
+		this->postProcessingDepthFBO = graph->getFramebuffer(0, this->postProcessingDepthTexture);
+	}
+
+	this->hiZTexture = graph->getTexture(hiZ);
+	this->ssrNormalTexture = graph->getTexture(ssrNormal);
+	this->ssrTexture = graph->getTexture(ssrColor);
+
+	if (this->ssrTexture != 0) {
+		this->hiZFBO = graph->getFramebuffer(this->hiZTexture, 0);
+		this->ssrNormalFBO = graph->getFramebuffer(this->ssrNormalTexture, this->postProcessingDepthTexture);
+		this->ssrFBO = graph->getFramebuffer(this->ssrTexture, 0);
+	}
+
+	this->velocityTexture = graph->getTexture(velocity);
+
+	if (this->velocityTexture != 0) {
+		this->velocityFBO = graph->getFramebuffer(this->velocityTexture, this->postProcessingDepthTexture);
+	}
+
+	for (int i = 0; i < 2; i++) {
+		this->outlineTexture[i] = graph->getTexture(outlineSeed[i]);
+
+		if (this->outlineTexture[i] != 0) {
+			this->outlineFBO[i] = graph->getFramebuffer(this->outlineTexture[i], 0);
+		}
+	}
+
+	this->upscaleTexture = graph->getTexture(upscaled);
+
+	if (this->upscaleTexture != 0) {
+		this->upscaleFBO = graph->getFramebuffer(this->upscaleTexture, 0);
+	}
+}
+
+// take the time of the entity draws of the last frame the timer read, averaged separately for the two vertex paths
+void Renderer::readForwardTime() {
+	GPUTimer* timer = this->renderGraph->getTimer();
+	int frame = timer->getLastFrame();
+
+	if (frame < 0 || frame == this->forwardFrame) {
+		return;
+	}
+
+	std::vector<gpuTiming_t> timings = timer->getLastTimings();
+	int path = this->forwardPaths[frame % GPU_TIMER_FRAMES];
+
+	for (int i = 0; i < timings.size(); i++) {
+		if (timings[i].name == "Forward Entities") {
+			this->forwardGPUTime[path] += (timings[i].gpuTime - this->forwardGPUTime[path]) * 0.05;
+			this->forwardCPUTime[path] += (timings[i].cpuTime - this->forwardCPUTime[path]) * 0.05;
+		}
+	}
+
+	this->forwardFrame = frame;
+}
+
+// take the GPU time of the last frame the render graph timer read and, in dynamic resolution mode, scale the render
+// resolution so that the frame time gets closer to targetFrameTime
+void Renderer::updateRenderScale() {
+	int frame = this->renderGraph->getTimer()->getLastFrame();
+	bool measured = frame >= 0 && frame != this->scaledFrame;
+
+	this->scaledFrame = frame;
+
+	if (dynamicResolution && measured) {
+		double frameTime = this->getGPUFrameTime() * 1000.0;
+
+		// nothing changes inside a small band around the target, so the resolution doesn't keep oscillating
+		if (fabs(frameTime - targetFrameTime) > targetFrameTime * 0.05) {
+			// the cost of the frame is mostly proportional to the number of pixels, which goes with the square of the scale
+			float desiredScale = renderScale * (float)sqrt(targetFrameTime / std::max(frameTime, 0.01));
+
+			// only move part of the way, the measurement is a few frames late
+			renderScale += (desiredScale - renderScale) * 0.2f;
+		}
+	}
+
+	// the temporal upsampling mode renders at a fixed fraction of the resolution and rebuilds the rest from the history,
+	// otherwise the spatial upscaling preset decides the fraction
+	if (!dynamicResolution) {
+		if (antiAliasing == taa && taaUpsampling) {
+			renderScale = std::min(std::max(taaRenderScale, 0.5f), 0.75f);
+		}
+		else if (antiAliasing != taa && upscaleQuality != noUpscaling) {
+			renderScale = this->getUpscaleRenderScale();
+		}
+	}
+
+	renderScale = std::min(std::max(renderScale, minRenderScale), 1.0f);
+
+	this->renderWidth = std::max((int)(screenWidth * renderScale + 0.5f), 1);
+	this->renderHeight = std::max((int)(screenHeight * renderScale + 0.5f), 1);
+}
+
+// render the cubemap view from the reflection camera to later calculate reflections on
+void Renderer::renderReflectionCubemap() {
+	// set the current camera to the camera inside the reflective object
+	defaultCamera = 1;
+
+	/* ACTIVE CAMERA: camera2 */
+
+	// set the viewport to fit the reflection texture resolution
+	glState->viewport(0, 0, reflectionRes, reflectionRes);
+
+	// cycle all the faces of the cubemap
+	for (int i = 0; i < 6; i++) {
+		// attach the positive X texture of the reflectionCubemap to the color buffer of the reflectionFBO
+		glState->framebufferTexture(this->reflectionFBO, GL_COLOR_ATTACHMENT0, this->reflectionCubemap, 0, i);
+		// aim the camera to face the correct direction
+		if (i == 0)      // FRONT
+			camera2.setOrientation(glm::vec3(0.0, 0.0, 0.0));
+		else if (i == 1) // BACK
+			camera2.setOrientation(glm::vec3(0.0, 180.0, 0.0));
+		else if (i == 2) // TOP
+			camera2.setOrientation(glm::vec3(0.0, -90.0, 90.0));
+		else if (i == 3) // BOTTOM
+			camera2.setOrientation(glm::vec3(0.0, -90.0, -90.0));
+		else if (i == 4) // RIGHT
+			camera2.setOrientation(glm::vec3(0.0, 90.0, 0.0));
+		else             // LEFT
+			camera2.setOrientation(glm::vec3(0.0, 270.0, 0.0));
+
+		// render all entities except for the ones that shouldn't be rendered in the reflection
+		this->renderEntities(true);
+		// clear the depth buffers from the reflectionFBO
+		glClear(GL_DEPTH_BUFFER_BIT);
+	}
+
+	// reset the viewport
+	glState->viewport(0, 0, this->renderWidth, this->renderHeight);
+
+	// set the render camera to the default camera
+	defaultCamera = 0;
+
+	/* ACTIVE CAMERA: camera1 */
+}
+
+// render all entities with their corresponding shader (forward rendering)
+void Renderer::renderEntities(bool reflection) {
+	// only the forward pass writes the entity ids
+	glState->stencilMask(reflection ? 0 : 255);
+	glStencilFunc(GL_ALWAYS, 0, 255);
+
+	this->bindEntityTextures(reflection);
+
+	// render entities
+	for (int i = 0; i < entityBuffer.size(); i++) {
+		// if it's rendering entities to be displayed in the reflection:
+		if (reflection) {
+			// check what entities are supposed to be rendered in the reflection
+			if (entityBuffer[i]->getToReflect() == true) {
+				// if it's rendering the skybox
+				if (entityBuffer[i]->getName().compare("skybox") == 0) {
+					// disable the depth mask (the rendering won't write into the depth buffer)
+					glState->depthMask(GL_FALSE);
+				}
+
+				// installs the shader to render the entity (it gets the shader from the entity), with its uniforms and vertex data
+				this->setupEntityDraw(entityBuffer[i]);
+
+				if (drawStatistics) {
+					this->drawProfiler->begin(i, entityBuffer[i]->getShader(), reflection ? reflectionDrawPass : forwardDrawPass);
+				}
+
+				// check which mode things should be rendered as
+				// if we're rendering the skybox, always render as triangles (weird results if you render with different primitives)
+				if (entityBuffer[i]->getName().compare("skybox") == 0) {
+					// render the skybox
+					glDrawArrays(GL_TRIANGLES, 0, entityBuffer[i]->getVertexCount());
+					// re-enable the depth mask (now rendering also affects the depth buffer as well)
+					glState->depthMask(GL_TRUE);
+				}
+
+				else {
+					switch (renderMode) {
+						// draw lines
+					case wireframe:
+						glDrawArrays(GL_LINES, 0, entityBuffer[i]->getVertexCount());
+						break;
+
+						// draw points
+					case vertices:
+						glPointSize(2.0f);
+						glDrawArrays(GL_POINTS, 0, entityBuffer[i]->getVertexCount());
+						break;
+
+						// draw in the element's primitive (mainly triangles)
+					default:
+						glDrawArrays(entityBuffer[i]->getElements(), 0, entityBuffer[i]->getVertexCount());
+					}
+				}
+
+				this->drawProfiler->end();
+			}
+		}
+
+		else {
+			// every entity leaves its id in the stencil buffer, the outline of the selected entity is built from it
+			glStencilFunc(GL_ALWAYS, this->getStencilID(i), 255);
+
+			if (entityBuffer[i]->getName().compare("skybox") == 0) {
+				glState->depthMask(GL_FALSE);
+			}
+
+			this->setupEntityDraw(entityBuffer[i]);
+
+			if (drawStatistics) {
+				this->drawProfiler->begin(i, entityBuffer[i]->getShader(), reflection ? reflectionDrawPass : forwardDrawPass);
+			}
+
+			// check which mode things should be rendered as
+			if (entityBuffer[i]->getName().compare("skybox") == 0) {
+				// render the skybox
+				glDrawArrays(GL_TRIANGLES, 0, entityBuffer[i]->getVertexCount());
+				// re-enable the depth mask (now rendering also affects the depth buffer as well)
+				glState->depthMask(GL_TRUE);
+			}
+
+			else {
+				switch (renderMode) {
+				case wireframe:
+					glLineWidth(5.0f);
+					glDrawArrays(GL_LINES, 0, entityBuffer[i]->getVertexCount());
+					break;
+
+				case vertices:
+					glPointSize(2.0f);
+					glDrawArrays(GL_POINTS, 0, entityBuffer[i]->getVertexCount());
+					break;
+
+				default:
+					glDrawArrays(entityBuffer[i]->getElements(), 0, entityBuffer[i]->getVertexCount());
+				}
+			}
+
+			this->drawProfiler->end();
+		}
+
+		glDisableVertexAttribArray(0);
+		glDisableVertexAttribArray(1);
+		glDisableVertexAttribArray(2);
+	}
+
+	glState->stencilMask(0);
+
+	// the wireframe outline is drawn over the selected entity, the other styles are composited from the stencil ids
+	// (entities without a stencil id always get the wireframe one)
+	if (this->highlightedEntity >= 0 && reflection == false && (outlineType == 2 || this->highlightedEntity >= OUTLINE_STENCIL_IDS)) {
+		glState->disable(GL_DEPTH_TEST);
+		glPolygonMode(GL_FRONT, GL_LINE);
+		glLineWidth(10.0f);
+		int previousShader = entityBuffer[this->highlightedEntity]->getShader();
+		entityBuffer[this->highlightedEntity]->setShader(11);
+		this->renderEntity(entityBuffer[this->highlightedEntity]);
+		entityBuffer[this->highlightedEntity]->setShader(previousShader);
+		glLineWidth(1.0f);
+		glPolygonMode(GL_FRONT, GL_FILL);
+		glState->enable(GL_DEPTH_TEST);
+	}
+}
+
+void Renderer::renderEntity(Entity* entity) {
+	if (entity->getName().compare("skybox") == 0) {
+		glState->depthMask(GL_FALSE);
+	}
+
+	this->setupEntityDraw(entity);
+
+
+	// check which mode things should be rendered as
+	if (entity->getName().compare("skybox") == 0) {
+		// render the skybox
+		glDrawArrays(GL_TRIANGLES, 0, entity->getVertexCount());
+		// re-enable the depth mask (now rendering also affects the depth buffer as well)
+		glState->depthMask(GL_TRUE);
+	}
+
+	else {
+		switch (renderMode) {
+		case wireframe:
+			glDrawArrays(GL_LINES, 0, entity->getVertexCount());
+			break;
+
+		case vertices:
+			glPointSize(2.0f);
+			glDrawArrays(GL_POINTS, 0, entity->getVertexCount());
+			break;
+
+		default:
+			glDrawArrays(entity->getElements(), 0, entity->getVertexCount());
+
+		}
+	}
+
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+	glDisableVertexAttribArray(2);
+}
+
+
+// outline of the selected entity: the pixels with its id in the stencil buffer seed a jump flood at reduced
+// resolution, which finds the closest pixel of the entity for every texel in log2(OUTLINE_MAX_WIDTH) passes,
+// then a single pass blends the outline of the chosen width over postProcessingTexture
+void Renderer::renderOutline() {
+	int seedWidth = (this->renderWidth + OUTLINE_DOWNSAMPLE - 1) / OUTLINE_DOWNSAMPLE;
+	int seedHeight = (this->renderHeight + OUTLINE_DOWNSAMPLE - 1) / OUTLINE_DOWNSAMPLE;
+	unsigned int selectedID = this->getStencilID(this->highlightedEntity);
+
+	glState->disable(GL_DEPTH_TEST);
+	glState->disable(GL_STENCIL_TEST);
+
+	// the depth-stencil texture is read as its stencil ids for the duration of the outline
+	glState->activeTexture(GL_TEXTURE0);
+	glState->bindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->screenDepthTexture);
+	glState->textureParameteri(this->screenDepthTexture, GL_TEXTURE_2D_MULTISAMPLE, GL_DEPTH_STENCIL_TEXTURE_MODE, GL_STENCIL_INDEX);
+
+	glState->viewport(0, 0, seedWidth, seedHeight);
+
+	// seeds
+	glState->bindFramebuffer(GL_FRAMEBUFFER, this->outlineFBO[0]);
+	glState->useProgram(this->outlineSeedShader->getID());
+	glState->uniform1i(glState->getUniformLocation(this->outlineSeedShader->getID(), "idTexture"), 0);
+	glState->uniform1ui(glState->getUniformLocation(this->outlineSeedShader->getID(), "selectedID"), selectedID);
+	glState->uniform1i(glState->getUniformLocation(this->outlineSeedShader->getID(), "downsample"), OUTLINE_DOWNSAMPLE);
+
+	this->drawScreenQuad();
+
+	// jump flood, the first step is big enough to carry the seeds as far as the widest outline
+	int current = 0;
+
+	glState->useProgram(this->jumpFloodShader->getID());
+	glState->uniform1i(glState->getUniformLocation(this->jumpFloodShader->getID(), "seedTexture"), 1);
+	glState->uniform2i(glState->getUniformLocation(this->jumpFloodShader->getID(), "size"), seedWidth, seedHeight);
+	int stepUniformID = glState->getUniformLocation(this->jumpFloodShader->getID(), "stepSize");
+
+	glState->activeTexture(GL_TEXTURE1);
+
+	for (int step = OUTLINE_MAX_WIDTH / OUTLINE_DOWNSAMPLE / 2; step >= 1; step /= 2) {
+		glState->bindFramebuffer(GL_FRAMEBUFFER, this->outlineFBO[1 - current]);
+		glState->bindTexture(GL_TEXTURE_2D, this->outlineTexture[current]);
+		glState->uniform1i(stepUniformID, step);
+
+		this->drawScreenQuad();
+
+		current = 1 - current;
+	}
+
+	// composite
+	glState->viewport(0, 0, this->renderWidth, this->renderHeight);
+	glState->bindFramebuffer(GL_FRAMEBUFFER, this->postProcessingFBO);
+
+	glState->bindTexture(GL_TEXTURE_2D, this->outlineTexture[current]);
+
+	// 0: solid, 1: fading with the distance
+	Shader* outlineShader = this->outlineShaders->getVariant("FADE", outlineType == 1);
+
+	glState->useProgram(outlineShader->getID());
+	glState->uniform1i(glState->getUniformLocation(outlineShader->getID(), "idTexture"), 0);
+	glState->uniform1i(glState->getUniformLocation(outlineShader->getID(), "seedTexture"), 1);
+	glState->uniform1ui(glState->getUniformLocation(outlineShader->getID(), "selectedID"), selectedID);
+	glState->uniform1i(glState->getUniformLocation(outlineShader->getID(), "downsample"), OUTLINE_DOWNSAMPLE);
+	glState->uniform1f(glState->getUniformLocation(outlineShader->getID(), "width"), std::min(std::max(outlineWidth, 1.0f), (float)OUTLINE_MAX_WIDTH));
+	glState->uniform3f(glState->getUniformLocation(outlineShader->getID(), "color"), outlineColor.x, outlineColor.y, outlineColor.z);
+
+	glState->enable(GL_BLEND);
+	glState->blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	this->drawScreenQuad();
+
+	glState->disable(GL_BLEND);
+
+	glState->activeTexture(GL_TEXTURE0);
+	glState->bindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->screenDepthTexture);
+	glState->textureParameteri(this->screenDepthTexture, GL_TEXTURE_2D_MULTISAMPLE, GL_DEPTH_STENCIL_TEXTURE_MODE, GL_DEPTH_COMPONENT);
+
+	glState->enable(GL_DEPTH_TEST);
+	glState->enable(GL_STENCIL_TEST);
+}
+
+// id written in the stencil buffer by an entity, 0 is left for the background and the entities past the ids
+int Renderer::getStencilID(int index) {
+	return(index < OUTLINE_STENCIL_IDS ? index + 1 : 0);
+}
+
+
+// resolve the multisampled forward pass into postProcessingTexture
+void Renderer::renderMultisamplePostProcessing() {
+	glState->bindFramebuffer(GL_FRAMEBUFFER, this->postProcessingFBO);
+
+	// hardware resolve: the samples are averaged by the blit, without going through a fragment shader
+	if (!depthBuffer && !shaderResolve) {
+		glState->bindFramebuffer(GL_READ_FRAMEBUFFER, this->screenFBO);
+		glBlitFramebuffer(0, 0, this->renderWidth, this->renderHeight, 0, 0, this->renderWidth, this->renderHeight, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+		glState->bindFramebuffer(GL_FRAMEBUFFER, this->postProcessingFBO);
+		return;
+	}
+
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	glState->disable(GL_DEPTH_TEST); // disable depth test so screen-space quad isn't discarded due to depth test.
+
+	// the variant for the sample count of the forward pass, which averages them in an unrolled loop
+	if (depthBuffer) {
+		glState->bindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->screenDepthTexture);
+		glState->useProgram(this->depthShaders->getVariant("SAMPLES", samples)->getID());
+	}
+	else {
+		glState->bindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->screenTexture);
+		glState->useProgram(this->screenShaders->getVariant("SAMPLES", samples)->getID());
+	}
+
+	
+
+	glEnableVertexAttribArray(0);
+	glState->bindBuffer(GL_ARRAY_BUFFER, this->screenVBO);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+	glEnableVertexAttribArray(1);
+	glState->bindBuffer(GL_ARRAY_BUFFER, this->screenUVVBO);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+	glDrawArrays(GL_TRIANGLES, 0, 6);
+
+	glState->enable(GL_DEPTH_TEST);
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+}
+
+// render the screen texture applying post processing shaders
+void Renderer::renderScreen() {
+	glState->disable(GL_DEPTH_TEST); // disable depth test so screen-space quad isn't discarded due to depth test.
+
+	// the rendered part of postProcessingTexture is stretched over the whole window
+	glState->viewport(0, 0, screenWidth, screenHeight);
+
+	glState->activeTexture(GL_TEXTURE0);
+
+	bool upscaling = this->isUpscaling();
+
+	// the temporal anti-aliasing and upscaler outputs are already at the screen resolution
+	float usedWidth = (float)this->renderWidth;
+	float usedHeight = (float)this->renderHeight;
+	unsigned int sourceTexture = this->postProcessingTexture;
+
+	if (antiAliasing == taa) {
+		sourceTexture = this->taaTexture[this->taaCurrent];
+		usedWidth = (float)screenWidth;
+		usedHeight = (float)screenHeight;
+	}
+	else if (upscaling) {
+		sourceTexture = this->upscaleTexture;
+		usedWidth = (float)screenWidth;
+		usedHeight = (float)screenHeight;
+	}
+
+	// FXAA and the sharpening after the upscale are folded into the final pass, so they don't cost an extra full screen copy
+	Shader* finalShader = this->postProcessingShader;
+
+	if (upscaling) {
+		finalShader = this->sharpenShader;
+	}
+	else if (antiAliasing == fxaa) {
+		finalShader = this->fxaaShader;
+	}
+
+	// the post processing chain takes the place of the plain copy, after FXAA or the sharpening it reads
+	// their output from its own target
+	if (this->postProcessing->isActive()) {
+		if (finalShader == this->postProcessingShader) {
+			this->postProcessing->render(sourceTexture, usedWidth / this->targetWidth, usedHeight / this->targetHeight,
+				(usedWidth - 0.5f) / this->targetWidth, (usedHeight - 0.5f) / this->targetHeight);
+
+			glState->enable(GL_DEPTH_TEST);
+			return;
+		}
+
+		glState->bindFramebuffer(GL_FRAMEBUFFER, this->postProcessing->getInputFBO());
+	}
+
+	glState->bindTexture(GL_TEXTURE_2D, sourceTexture);
+	glState->useProgram(finalShader->getID());
+
+	glEnableVertexAttribArray(0);
+	glState->bindBuffer(GL_ARRAY_BUFFER, this->screenVBO);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+	glEnableVertexAttribArray(1);
+	glState->bindBuffer(GL_ARRAY_BUFFER, this->screenUVVBO);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+	int screenTexUniformID = glState->getUniformLocation(finalShader->getID(), "screenTexture");
+
+	glState->uniform1i(screenTexUniformID, 0);
+	glState->uniform2f(glState->getUniformLocation(finalShader->getID(), "uvScale"), usedWidth / this->targetWidth, usedHeight / this->targetHeight);
+	glState->uniform2f(glState->getUniformLocation(finalShader->getID(), "uvMax"), (usedWidth - 0.5f) / this->targetWidth, (usedHeight - 0.5f) / this->targetHeight);
+
+	if (upscaling) {
+		glState->uniform1f(glState->getUniformLocation(finalShader->getID(), "sharpness"), upscaleSharpness);
+		glState->uniform2i(glState->getUniformLocation(finalShader->getID(), "size"), screenWidth, screenHeight);
+	}
+	else if (antiAliasing == fxaa) {
+		glState->uniform2f(glState->getUniformLocation(finalShader->getID(), "texelSize"), 1.0f / this->targetWidth, 1.0f / this->targetHeight);
+	}
+
+	glDrawArrays(GL_TRIANGLES, 0, 6);
+
+	if (this->postProcessing->isActive()) {
+		glState->bindFramebuffer(GL_FRAMEBUFFER, 0);
+		this->postProcessing->render(this->postProcessing->getInputTexture(), (float)screenWidth / this->targetWidth, (float)screenHeight / this->targetHeight,
+			(screenWidth - 0.5f) / this->targetWidth, (screenHeight - 0.5f) / this->targetHeight);
+	}
+
+	glState->enable(GL_DEPTH_TEST);
+}
+
+// resolve the multisampled depth of the forward pass into postProcessingDepthTexture, for the passes that read
+// the depth or draw the surfaces again
+void Renderer::resolveDepth() {
+	glState->bindFramebuffer(GL_READ_FRAMEBUFFER, this->screenFBO);
+	glState->bindFramebuffer(GL_DRAW_FRAMEBUFFER, this->postProcessingDepthFBO);
+	glBlitFramebuffer(0, 0, this->renderWidth, this->renderHeight, 0, 0, this->renderWidth, this->renderHeight, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+}
+
+// the spatial upscaler replaces the bilinear stretch when rendering below the screen resolution,
+// TAA doesn't need it since its output is already at the screen resolution
+bool Renderer::isUpscaling() {
+	return(upscaleQuality != noUpscaling && antiAliasing != taa &&
+		(this->renderWidth < (int)screenWidth || this->renderHeight < (int)screenHeight));
+}
+
+// edge adaptive upsample of postProcessingTexture to the screen resolution, sharpened later by the final pass
+void Renderer::renderUpscale() {
+	glState->disable(GL_DEPTH_TEST);
+	glState->viewport(0, 0, screenWidth, screenHeight);
+
+	glState->bindFramebuffer(GL_FRAMEBUFFER, this->upscaleFBO);
+
+	glState->useProgram(this->upscaleShader->getID());
+	glState->uniform1i(glState->getUniformLocation(this->upscaleShader->getID(), "screenTexture"), 0);
+	glState->uniform2f(glState->getUniformLocation(this->upscaleShader->getID(), "renderSize"), (float)this->renderWidth, (float)this->renderHeight);
+
+	glState->activeTexture(GL_TEXTURE0);
+	glState->bindTexture(GL_TEXTURE_2D, this->postProcessingTexture);
+
+	this->drawScreenQuad();
+
+	glState->enable(GL_DEPTH_TEST);
+}
+
+// screen space reflections: the resolved depth is turned into a hierarchical depth buffer, the reflected rays of the
+// surfaces whose shader has screen space reflections enabled are traced against it at half resolution (falling back
+// to the skybox on misses) and the result is upsampled on top of postProcessingTexture
+void Renderer::renderScreenSpaceReflection() {
+	int halfWidth = std::max(this->renderWidth / 2, 1);
+	int halfHeight = std::max(this->renderHeight / 2, 1);
+
+	glm::mat4 projectionMatrix = projectionBuffer[0];
+	glm::mat4 inverseProjectionMatrix = glm::inverse(projectionMatrix);
+	glm::mat4 inverseViewMatrix = glm::inverse(cameraBuffer[0]->getViewMatrix());
+
+	glState->disable(GL_DEPTH_TEST);
+	glState->disable(GL_STENCIL_TEST);
+
+	// ------------------------------------ HIERARCHICAL DEPTH ------------------------------------ //
+
+	glState->bindFramebuffer(GL_FRAMEBUFFER, this->hiZFBO);
+	glState->useProgram(this->hiZShader->getID());
+
+	glState->uniform1i(glState->getUniformLocation(this->hiZShader->getID(), "depthTexture"), 0);
+	glState->uniform1i(glState->getUniformLocation(this->hiZShader->getID(), "hiZTexture"), 1);
+	int previousLevelUniformID = glState->getUniformLocation(this->hiZShader->getID(), "previousLevel");
+
+	glState->activeTexture(GL_TEXTURE0);
+	glState->bindTexture(GL_TEXTURE_2D, this->postProcessingDepthTexture);
+	glState->activeTexture(GL_TEXTURE1);
+	glState->bindTexture(GL_TEXTURE_2D, this->hiZTexture);
+
+	// the rendered area of every level, which can't get bigger than the level itself
+	int levelWidth = this->renderWidth;
+	int levelHeight = this->renderHeight;
+	int textureWidth = this->targetWidth;
+	int textureHeight = this->targetHeight;
+
+	for (int level = 0; level < this->hiZLevels; level++) {
+		// only the levels below the one being written are visible to the shader, so there's no feedback loop
+		glState->textureParameteri(this->hiZTexture, GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, std::max(level - 1, 0));
+		glState->framebufferTexture(this->hiZFBO, GL_COLOR_ATTACHMENT0, this->hiZTexture, level, -1);
+
+		glState->viewport(0, 0, levelWidth, levelHeight);
+		glState->uniform1i(previousLevelUniformID, level - 1);
+
+		this->drawScreenQuad();
+
+		textureWidth = std::max(textureWidth / 2, 1);
+		textureHeight = std::max(textureHeight / 2, 1);
+		levelWidth = std::min((levelWidth + 1) / 2, textureWidth);
+		levelHeight = std::min((levelHeight + 1) / 2, textureHeight);
+	}
+
+	glState->textureParameteri(this->hiZTexture, GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, this->hiZLevels - 1);
+
+	// -------------------------------------- SURFACE NORMALS ------------------------------------- //
+
+	glState->bindFramebuffer(GL_FRAMEBUFFER, this->ssrNormalFBO);
+	glState->viewport(0, 0, this->renderWidth, this->renderHeight);
+
+	// alpha 0 marks the pixels that don't need to be traced
+	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+
+	// only the visible surfaces are kept by testing against the resolved depth without writing to it,
+	// the offset compensates for the depth resolve picking a single sample
+	glState->enable(GL_DEPTH_TEST);
+	glState->depthFunc(GL_LEQUAL);
+	glState->depthMask(GL_FALSE);
+	glState->enable(GL_POLYGON_OFFSET_FILL);
+	glPolygonOffset(-1.0f, -1.0f);
+
+	glState->useProgram(this->ssrNormalShader->getID());
+	int reflectivityUniformID = glState->getUniformLocation(this->ssrNormalShader->getID(), "reflectivity");
+
+	for (int i = 0; i < entityBuffer.size(); i++) {
+		Shader* entityShader = &shaderBuffer[entityBuffer[i]->getShader()];
+
+		if (!entityShader->getScreenSpaceReflection() || entityBuffer[i]->getElements() != GL_TRIANGLES ||
+			entityBuffer[i]->getName().compare("skybox") == 0) {
+			continue;
+		}
+
+		glState->uniform1f(reflectivityUniformID, entityShader->getReflectivity());
+
+		this->attachUniforms(entityBuffer[i], this->ssrNormalShader->getUniformSlots());
+		this->linkLayouts(entityBuffer[i], this->ssrNormalShader->getLayoutSlots());
+
+		glDrawArrays(GL_TRIANGLES, 0, entityBuffer[i]->getVertexCount());
+
+		glDisableVertexAttribArray(0);
+		glDisableVertexAttribArray(2);
+	}
+
+	glState->disable(GL_POLYGON_OFFSET_FILL);
+	glState->depthMask(GL_TRUE);
+	glState->depthFunc(GL_LESS);
+	glState->disable(GL_DEPTH_TEST);
+
+	// ------------------------------------------ RAY MARCH --------------------------------------- //
+
+	glState->bindFramebuffer(GL_FRAMEBUFFER, this->ssrFBO);
+	glState->viewport(0, 0, halfWidth, halfHeight);
+
+	glState->useProgram(this->ssrShader->getID());
+
+	glState->uniform1i(glState->getUniformLocation(this->ssrShader->getID(), "hiZTexture"), 0);
+	glState->uniform1i(glState->getUniformLocation(this->ssrShader->getID(), "normalTexture"), 1);
+	glState->uniform1i(glState->getUniformLocation(this->ssrShader->getID(), "colorTexture"), 2);
+	glState->uniform1i(glState->getUniformLocation(this->ssrShader->getID(), "skybox"), 3);
+	glState->uniformMatrix4fv(glState->getUniformLocation(this->ssrShader->getID(), "projectionMatrix"), 1, GL_FALSE, &(projectionMatrix[0][0]));
+	glState->uniformMatrix4fv(glState->getUniformLocation(this->ssrShader->getID(), "inverseProjectionMatrix"), 1, GL_FALSE, &(inverseProjectionMatrix[0][0]));
+	glState->uniformMatrix4fv(glState->getUniformLocation(this->ssrShader->getID(), "inverseViewMatrix"), 1, GL_FALSE, &(inverseViewMatrix[0][0]));
+	glState->uniform1i(glState->getUniformLocation(this->ssrShader->getID(), "maxLevel"), this->hiZLevels - 1);
+	glState->uniform1i(glState->getUniformLocation(this->ssrShader->getID(), "maxSteps"), 64);
+	glState->uniform1f(glState->getUniformLocation(this->ssrShader->getID(), "maxDistance"), 200.0f);
+	glState->uniform1f(glState->getUniformLocation(this->ssrShader->getID(), "thickness"), 1.0f);
+	glState->uniform2f(glState->getUniformLocation(this->ssrShader->getID(), "viewportScale"), (float)this->renderWidth / this->targetWidth, (float)this->renderHeight / this->targetHeight);
+
+	glState->activeTexture(GL_TEXTURE0);
+	glState->bindTexture(GL_TEXTURE_2D, this->hiZTexture);
+	glState->activeTexture(GL_TEXTURE1);
+	glState->bindTexture(GL_TEXTURE_2D, this->ssrNormalTexture);
+	glState->activeTexture(GL_TEXTURE2);
+	glState->bindTexture(GL_TEXTURE_2D, this->postProcessingTexture);
+	glState->activeTexture(GL_TEXTURE3);
+	glState->bindTexture(GL_TEXTURE_CUBE_MAP, entityBuffer[0]->getTexture());
+
+	this->drawScreenQuad();
+
+	// ------------------------------------------ COMPOSITE --------------------------------------- //
+
+	glState->bindFramebuffer(GL_FRAMEBUFFER, this->postProcessingFBO);
+	glState->viewport(0, 0, this->renderWidth, this->renderHeight);
+
+	// the reflection alpha is the reflectivity of the surface
+	glState->enable(GL_BLEND);
+	glState->blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	glState->useProgram(this->ssrCompositeShader->getID());
+
+	glState->uniform1i(glState->getUniformLocation(this->ssrCompositeShader->getID(), "reflectionTexture"), 0);
+	glState->uniform1i(glState->getUniformLocation(this->ssrCompositeShader->getID(), "hiZTexture"), 1);
+	glState->uniformMatrix4fv(glState->getUniformLocation(this->ssrCompositeShader->getID(), "inverseProjectionMatrix"), 1, GL_FALSE, &(inverseProjectionMatrix[0][0]));
+	glState->uniform2i(glState->getUniformLocation(this->ssrCompositeShader->getID(), "reflectionSize"), halfWidth, halfHeight);
+
+	glState->activeTexture(GL_TEXTURE0);
+	glState->bindTexture(GL_TEXTURE_2D, this->ssrTexture);
+	glState->activeTexture(GL_TEXTURE1);
+	glState->bindTexture(GL_TEXTURE_2D, this->hiZTexture);
+
+	this->drawScreenQuad();
+
+	glState->disable(GL_BLEND);
+	glState->activeTexture(GL_TEXTURE0);
+
+	glState->enable(GL_DEPTH_TEST);
+	glState->enable(GL_STENCIL_TEST);
+}
+
+// temporal anti-aliasing: the motion of the entities that moved is written to velocityTexture, then the jittered
+// frame is blended into the history reprojected with the camera and entity motion, clamped to the colors of the
+// neighbourhood to reject stale history. The output is at screen resolution, also when rendering below it
+void Renderer::renderTemporalAntiAliasing() {
+	int previous = this->taaCurrent;
+	this->taaCurrent = 1 - this->taaCurrent;
+
+	glm::mat4 viewProjection = this->projection * cameraBuffer[0]->getViewMatrix();
+	glm::mat4 inverseViewProjection = glm::inverse(viewProjection);
+
+	glState->disable(GL_DEPTH_TEST);
+	glState->disable(GL_STENCIL_TEST);
+
+	// --------------------------------------- ENTITY MOTION -------------------------------------- //
+
+	glState->bindFramebuffer(GL_FRAMEBUFFER, this->velocityFBO);
+	glState->viewport(0, 0, this->renderWidth, this->renderHeight);
+
+	// static entities only move with the camera, which the resolve reconstructs from the depth
+	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+
+	glState->enable(GL_DEPTH_TEST);
+	glState->depthFunc(GL_LEQUAL);
+	glState->depthMask(GL_FALSE);
+	glState->enable(GL_POLYGON_OFFSET_FILL);
+	glPolygonOffset(-1.0f, -1.0f);
+
+	glState->useProgram(this->motionShader->getID());
+	glState->uniformMatrix4fv(glState->getUniformLocation(this->motionShader->getID(), "previousViewProjection"), 1, GL_FALSE, &(this->previousViewProjection[0][0]));
+	int previousModelUniformID = glState->getUniformLocation(this->motionShader->getID(), "previousModelMatrix");
+
+	for (int i = 0; i < entityBuffer.size(); i++) {
+		if (entityBuffer[i]->getModelMatrix() == entityBuffer[i]->getPreviousModelMatrix() ||
+			entityBuffer[i]->getElements() != GL_TRIANGLES || entityBuffer[i]->getName().compare("skybox") == 0) {
+			continue;
+		}
+
+		glState->uniformMatrix4fv(previousModelUniformID, 1, GL_FALSE, &(entityBuffer[i]->getPreviousModelMatrix()[0][0]));
+
+		this->attachUniforms(entityBuffer[i], this->motionShader->getUniformSlots());
+		this->linkLayouts(entityBuffer[i], this->motionShader->getLayoutSlots());
+
+		glDrawArrays(GL_TRIANGLES, 0, entityBuffer[i]->getVertexCount());
+
+		glDisableVertexAttribArray(0);
+	}
+
+	glState->disable(GL_POLYGON_OFFSET_FILL);
+	glState->depthMask(GL_TRUE);
+	glState->depthFunc(GL_LESS);
+	glState->disable(GL_DEPTH_TEST);
+
+	// ------------------------------------------ RESOLVE ----------------------------------------- //
+
+	glState->bindFramebuffer(GL_FRAMEBUFFER, this->taaFBO[this->taaCurrent]);
+	glState->viewport(0, 0, screenWidth, screenHeight);
+
+	glState->useProgram(this->taaShader->getID());
+
+	glState->uniform1i(glState->getUniformLocation(this->taaShader->getID(), "currentTexture"), 0);
+	glState->uniform1i(glState->getUniformLocation(this->taaShader->getID(), "depthTexture"), 1);
+	glState->uniform1i(glState->getUniformLocation(this->taaShader->getID(), "velocityTexture"), 2);
+	glState->uniform1i(glState->getUniformLocation(this->taaShader->getID(), "historyTexture"), 3);
+	glState->uniform2f(glState->getUniformLocation(this->taaShader->getID(), "renderSize"), (float)this->renderWidth, (float)this->renderHeight);
+	glState->uniform2f(glState->getUniformLocation(this->taaShader->getID(), "jitter"), this->jitter.x, this->jitter.y);
+	glState->uniformMatrix4fv(glState->getUniformLocation(this->taaShader->getID(), "inverseViewProjection"), 1, GL_FALSE, &(inverseViewProjection[0][0]));
+	glState->uniformMatrix4fv(glState->getUniformLocation(this->taaShader->getID(), "previousViewProjection"), 1, GL_FALSE, &(this->previousViewProjection[0][0]));
+	glState->uniform1f(glState->getUniformLocation(this->taaShader->getID(), "feedback"), taaFeedback);
+	glState->uniform1i(glState->getUniformLocation(this->taaShader->getID(), "resetHistory"), !this->taaHistoryValid);
+	glState->uniform2f(glState->getUniformLocation(this->taaShader->getID(), "historyScale"), (float)screenWidth / this->targetWidth, (float)screenHeight / this->targetHeight);
+	glState->uniform2f(glState->getUniformLocation(this->taaShader->getID(), "historyMax"), (screenWidth - 0.5f) / this->targetWidth, (screenHeight - 0.5f) / this->targetHeight);
+
+	glState->activeTexture(GL_TEXTURE0);
+	glState->bindTexture(GL_TEXTURE_2D, this->postProcessingTexture);
+	glState->activeTexture(GL_TEXTURE1);
+	glState->bindTexture(GL_TEXTURE_2D, this->postProcessingDepthTexture);
+	glState->activeTexture(GL_TEXTURE2);
+	glState->bindTexture(GL_TEXTURE_2D, this->velocityTexture);
+	glState->activeTexture(GL_TEXTURE3);
+	glState->bindTexture(GL_TEXTURE_2D, this->taaTexture[previous]);
+
+	this->drawScreenQuad();
+
+	this->taaHistoryValid = true;
+
+	glState->activeTexture(GL_TEXTURE0);
+
+	glState->enable(GL_DEPTH_TEST);
+	glState->enable(GL_STENCIL_TEST);
+}
+
+// the history lives across frames, so it's kept outside the render graph
+void Renderer::setupTemporalAntiAliasing() {
+	// the output of a frame is the history of the next one
+	glState->deleteTextures(2, this->taaTexture);
+	glState->deleteFramebuffers(2, this->taaFBO);
+
+	for (int i = 0; i < 2; i++) {
+		this->taaTexture[i] = glState->createTexture(GL_TEXTURE_2D, GL_RGBA16F, this->targetWidth, this->targetHeight, 1, 0);
+		glState->setTextureSampler(this->taaTexture[i], glState->getSampler(GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE));
+
+		this->taaFBO[i] = glState->createFramebuffer();
+		glState->framebufferTexture(this->taaFBO[i], GL_COLOR_ATTACHMENT0, this->taaTexture[i], 0, -1);
+	}
+
+	this->taaHistoryValid = false;
+}
+
+// element of the halton low discrepancy sequence, used for well spread out jitter offsets
+float Renderer::halton(int index, int base) {
+	float result = 0.0f;
+	float fraction = 1.0f;
+
+	while (index > 0) {
+		fraction /= base;
+		result += fraction * (index % base);
+		index /= base;
+	}
+
+	return(result);
+}
+
+// draw the square covering the whole screen, used by the full screen passes
+void Renderer::drawScreenQuad() {
+	glEnableVertexAttribArray(0);
+	glState->bindBuffer(GL_ARRAY_BUFFER, this->screenVBO);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+	glEnableVertexAttribArray(1);
+	glState->bindBuffer(GL_ARRAY_BUFFER, this->screenUVVBO);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+	glDrawArrays(GL_TRIANGLES, 0, 6);
+
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+}
+
+void Renderer::resetRender() {
+	glBufferData(GL_ARRAY_BUFFER, data1.size() * sizeof(float), &data1[0], GL_STATIC_DRAW);
+
+	glState->useProgram(shaderBuffer[1].getID());
+	glState->uniformMatrix4fv(shaderBuffer[1].getUniformSlots()[modelMatrixUniform], 1, GL_FALSE, &(glm::mat4(1.0f)[0][0]));
+	glState->uniformMatrix4fv(shaderBuffer[1].getUniformSlots()[viewMatrixUniform], 1, GL_FALSE, &(camera.getViewMatrix()[0][0]));
+	glState->uniformMatrix4fv(shaderBuffer[1].getUniformSlots()[projectionMatrixUniform], 1, GL_FALSE, &(Projection[0][0]));
+	glState->uniform3f(glState->getUniformLocation(shaderBuffer[1].getID(), "color"), 255, 255, 255);
+
+	glEnableVertexAttribArray(0);
+
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+	glDrawArrays(GL_LINES, 0, data1.size());
+
+	glDisableVertexAttribArray(0);
+}
+
+// while the window is being dragged this runs every frame, so it doesn't touch the targets: they're only reallocated
+// by updateTargetSize
+void Renderer::resizeScreen() {
+	this->resizeTime = glfwGetTime();
+	// the history pixels don't line up with the new screen
+	this->taaHistoryValid = false;
+
+	glState->viewport(0, 0, screenWidth, screenHeight);
+
+	projectionBuffer[0] = glm::perspective(glm::radians(45.0f), (float)screenWidth / (float)screenHeight, 0.1f, 10000.0f);
+	updated = true;
+}
+
+// the targets are allocated in size classes: they grow as soon as the screen doesn't fit in them (to the size class of
+// the screen, so the next few frames of a drag fit too), and shrink to the size class of the screen only once the
+// size stopped changing for RENDER_TARGET_SETTLE_TIME. The render graph reads targetWidth and targetHeight when
+// declaring its targets, so its pool follows without reallocating on every resize
+void Renderer::updateTargetSize() {
+	int classWidth = this->getSizeClass(screenWidth);
+	int classHeight = this->getSizeClass(screenHeight);
+	int width = this->targetWidth;
+	int height = this->targetHeight;
+
+	if ((int)screenWidth > width || (int)screenHeight > height) {
+		width = std::max(width, classWidth);
+		height = std::max(height, classHeight);
+	}
+	else if (glfwGetTime() - this->resizeTime > RENDER_TARGET_SETTLE_TIME) {
+		width = classWidth;
+		height = classHeight;
+	}
+
+	if (width == this->targetWidth && height == this->targetHeight) {
+		return;
+	}
+
+	this->targetWidth = width;
+	this->targetHeight = height;
+
+	this->setupTemporalAntiAliasing();
+	this->postProcessing->resize(this->targetWidth, this->targetHeight);
+}
+
+// smallest multiple of RENDER_TARGET_SIZE_CLASS holding the given size
+int Renderer::getSizeClass(int size) {
+	return(std::max((size + RENDER_TARGET_SIZE_CLASS - 1) / RENDER_TARGET_SIZE_CLASS, 1) * RENDER_TARGET_SIZE_CLASS);
+}
+
+// add the enabled bounding volumes of every entity to the debug draw and draw them all at once
+void Renderer::displayBoundingBox() {
+	this->debugDraw->begin();
+
+	for (int i = 0; i < entityBuffer.size(); i++) {
+		if (drawOBB) {
+			this->debugDraw->box(entityBuffer[i]->getObjectBoundingBox(true), glm::vec3(1, 0, 0));
+		}
+
+		if (drawAABB1) {
+			this->debugDraw->box(entityBuffer[i]->getExternalAxisAlignedBoundingBox(true), glm::vec3(0, 1, 0));
+		}
+
+		if (drawAABB2) {
+			this->debugDraw->box(entityBuffer[i]->getInternalAxisAlignedBoundingBox(true), glm::vec3(0, 0, 1));
+		}
+
+		// halfway between the internal and the external box
+		if (drawAABB3) {
+			bounds_t internalWorldBounds = entityBuffer[i]->getInternalAxisAlignedBoundingBox(true);
+			bounds_t worldBounds = entityBuffer[i]->getExternalAxisAlignedBoundingBox(true);
+			bounds_t averageBounds;
+
+			averageBounds.a = (worldBounds.a + internalWorldBounds.a) / 2.0f;
+			averageBounds.b = (worldBounds.b + internalWorldBounds.b) / 2.0f;
+			averageBounds.c = (worldBounds.c + internalWorldBounds.c) / 2.0f;
+			averageBounds.d = (worldBounds.d + internalWorldBounds.d) / 2.0f;
+			averageBounds.e = (worldBounds.e + internalWorldBounds.e) / 2.0f;
+			averageBounds.f = (worldBounds.f + internalWorldBounds.f) / 2.0f;
+			averageBounds.g = (worldBounds.g + internalWorldBounds.g) / 2.0f;
+			averageBounds.h = (worldBounds.h + internalWorldBounds.h) / 2.0f;
+
+			this->debugDraw->box(averageBounds, glm::vec3(0, 1, 1));
+		}
+
+		if (drawAABB4) {
+			this->debugDraw->box(entityBuffer[i]->getAxisAlignedBoundingBox(true), glm::vec3(1, 0, 1));
+		}
+
+		if (drawBS) {
+			this->debugDraw->sphere(entityBuffer[i]->getWorldPosition(), entityBuffer[i]->getInternalBoundingSphere(false), glm::vec3(1, 1, 0));
+		}
+
+		if (drawBS2) {
+			this->debugDraw->sphere(entityBuffer[i]->getWorldPosition(), entityBuffer[i]->getExternalBoundingSphere(false), glm::vec3(1, 0.5, 0));
+		}
+
+		if (drawBS3) {
+			this->debugDraw->sphere(entityBuffer[i]->getWorldPosition(), entityBuffer[i]->getBoundingSphere(false), glm::vec3(0.5, 1, 0));
+		}
+	}
+
+	this->debugDraw->flush(cameraBuffer[0]->getViewMatrix(), projectionBuffer[0]);
+}
+
+void Renderer::setHighlightedEntity(int index) {
+	this->highlightedEntity = index;
+}
+
+// pass the correct values to the corresponding uniforms in the shader
+void Renderer::attachUniforms(Entity* entity, const int* uniformSlots) {
+	// set the entity modelMatrix
+	if (uniformSlots[modelMatrixUniform] >= 0) {
+		glState->uniformMatrix4fv(uniformSlots[modelMatrixUniform], 1, GL_FALSE, &(entity->getModelMatrix()[0][0]));
+	}
+
+	// set the camera viewMatrix
+	if (uniformSlots[viewMatrixUniform] >= 0) {
+		// if the entity we're rendering is the skybox, 
+		if (entity->getName().compare("skybox") == 0) {
+			// this process removes all the translations from the camera, this way camera movement is not taken into account
+			glm::mat4 staticCameraView = glm::mat4(glm::mat3(cameraBuffer[defaultCamera]->getViewMatrix()));
+			glState->uniformMatrix4fv(uniformSlots[viewMatrixUniform], 1, GL_FALSE, &(staticCameraView[0][0]));
+		}
+		// otherwise pass the camera view matrix, including all translations
+		else {
+			glState->uniformMatrix4fv(uniformSlots[viewMatrixUniform], 1, GL_FALSE, &(cameraBuffer[defaultCamera]->getViewMatrix()[0][0]));
+		}
+	}
+
+	// set the main camera projection matrix in the projectionBuffer
+	if (uniformSlots[projectionMatrixUniform] >= 0) {
+		glState->uniformMatrix4fv(uniformSlots[projectionMatrixUniform], 1, GL_FALSE, &(projectionBuffer[defaultCamera][0][0]));
+	}
+
+	// pass the light position (x, y, z)
+	if (uniformSlots[lightPositionUniform] >= 0) {
+		glState->uniform3f(uniformSlots[lightPositionUniform], light->getWorldPosition().x, light->getWorldPosition().y, light->getWorldPosition().z);
+	}
+
+	// pass the camera position (x, y, z)
+	if (uniformSlots[eyePositionUniform] >= 0) {
+		glState->uniform3f(uniformSlots[eyePositionUniform], cameraBuffer[defaultCamera]->getPosition().x, cameraBuffer[defaultCamera]->getPosition().y, cameraBuffer[defaultCamera]->getPosition().z);
+	}
+
+	// pass where the entity data starts in the mesh buffer (vertex pulling)
+	if (uniformSlots[meshOffsetsUniform] >= 0) {
+		meshOffsets_t mesh = this->meshPool->getMesh(entity);
+		glState->uniform3i(uniformSlots[meshOffsetsUniform], mesh.vertices, mesh.uvs, mesh.normals);
+	}
+
+	// pass the index of the entity texture in the material buffer
+	if (uniformSlots[materialIndexUniform] >= 0) {
+		int material = entity->getTextureType() == GL_TEXTURE_2D ? this->materials->getMaterial(entity->getTexture()) : -1;
+		glState->uniform1i(uniformSlots[materialIndexUniform], material);
+	}
+}
+
+// install the shader of an entity and pass the values for its uniforms, then point it to the vertex data of the entity:
+// the attributes are linked to the entity buffers, or in the vertex pulling path the shader reads them from the mesh
+// buffer at the offsets passed as the meshOffsets uniform. Entities whose shader isn't compiled yet, or failed to, use
+// the fallback
+void Renderer::setupEntityDraw(Entity* entity) {
+	Shader* shader = &shaderBuffer[entity->getShader()];
+
+	if (!shader->isReady() || shader->hasFailed()) {
+		glState->useProgram(this->fallbackShader->getID());
+		this->attachUniforms(entity, this->fallbackShader->getUniformSlots());
+		this->linkLayouts(entity, this->fallbackShader->getLayoutSlots());
+		return;
+	}
+
+	if (this->pulling && shader->getPullingID() != 0) {
+		glState->useProgram(shader->getPullingID());
+		this->attachUniforms(entity, shader->getPullingUniformSlots());
+	}
+	else {
+		glState->useProgram(shader->getID());
+		this->attachUniforms(entity, shader->getUniformSlots());
+		this->linkLayouts(entity, shader->getLayoutSlots());
+	}
+
+	this->bindEntityTexture(entity);
+}
+
+// bind the texture of an entity for the next draw, the 2D textures of the shaders that take a material index are
+// already reachable through the material buffer
+void Renderer::bindEntityTexture(Entity* entity) {
+	if (entity->getTexture() == 0) {
+		return;
+	}
+
+	if (entity->getTextureType() == GL_TEXTURE_2D && this->usesMaterials(&shaderBuffer[entity->getShader()])) {
+		return;
+	}
+
+	glState->bindTexture(entity->getTextureType(), entity->getTexture());
+}
+
+// bind what the entity draws of a pass share: the material buffer and arrays, the mesh buffer, and the environment
+// cubemap of the reflective shaders, which can't be the reflection cubemap while it's being rendered to
+void Renderer::bindEntityTextures(bool reflection) {
+	this->materials->bind();
+
+	if (this->pulling) {
+		this->meshPool->bind();
+	}
+
+	glState->activeTexture(GL_TEXTURE0 + ENVIRONMENT_TEXTURE_UNIT);
+
+	if (doReflection && !reflection) {
+		glState->bindTexture(GL_TEXTURE_CUBE_MAP, this->reflectionCubemap);
+	}
+	else {
+		glState->bindTexture(GL_TEXTURE_CUBE_MAP, entityBuffer[0]->getTexture());
+	}
+
+	glState->activeTexture(GL_TEXTURE0);
+}
+
+bool Renderer::usesMaterials(Shader* shader) {
+	return(shader->hasUniform(materialIndexUniform));
+}
+
+// link layouts to the data origin (mainly VAO)
+void Renderer::linkLayouts(Entity* entity, const int* layoutSlots) {
+	// the "vertex" layout contains the entity vertices that make the geometry of the entity
+	if (layoutSlots[vertexLayout] >= 0) {
+		// enable the attribute at the location of the layout
+		glEnableVertexAttribArray(layoutSlots[vertexLayout]);
+		// bind the geometry VBO of the entity
+		glState->bindBuffer(GL_ARRAY_BUFFER, entity->getVertexBuffer());
+		// setup the attribute to reference the VBO
+		glVertexAttribPointer(layoutSlots[vertexLayout], 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+	}
+
+	// the "uv" layout contains the UV coordinates to map the texture to the geometry
+	if (layoutSlots[uvLayout] >= 0) {
+		glEnableVertexAttribArray(layoutSlots[uvLayout]);
+		// bind the UV VBO of the entity
+		glState->bindBuffer(GL_ARRAY_BUFFER, entity->getTexBuffer());
+		glVertexAttribPointer(layoutSlots[uvLayout], 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+	}
+
+	// the "color" layout contains the color vectors that make the entity color
+	if (layoutSlots[colorLayout] >= 0) {
+		glEnableVertexAttribArray(layoutSlots[colorLayout]);
+		// bind the color VBO of the entity
+		glState->bindBuffer(GL_ARRAY_BUFFER, entity->getTexBuffer());
+		glVertexAttribPointer(layoutSlots[colorLayout], 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+	}
+
+	// the "normal" layout contains the normals to the vertices, used for light calculation
+	if (layoutSlots[normalLayout] >= 0) {
+		glEnableVertexAttribArray(layoutSlots[normalLayout]);
+		// bind the normal VBO of the entity
+		glState->bindBuffer(GL_ARRAY_BUFFER, entity->getNormalBuffer());
+		glVertexAttribPointer(layoutSlots[normalLayout], 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+	}
+}
+
+double Renderer::getReflectionRenderTime(bool gpu) {
+	return(this->getPassTime({ "Reflection Cubemap" }, gpu));
+}
+
+double Renderer::getForwardRenderTime(bool gpu) {
+	return(this->getPassTime({ "Forward" }, gpu));
+}
+
+double Renderer::getMSPostProcessingPassTime(bool gpu) {
+	return(this->getPassTime({ "Resolve", "Depth View" }, gpu));
+}
+
+double Renderer::getPostProcessingPassTime(bool gpu) {
+	return(this->getPassTime({ "Outline", "Upscale", "Screen" }, gpu));
+}
+
+double Renderer::getPassTime(std::vector<std::string> passes, bool gpu) {
+	double time = 0.0;
+
+	for (int i = 0; i < passes.size(); i++) {
+		time += this->renderGraph->getTimer()->getTime(passes[i], gpu);
+	}
+
+	return(time);
+}
+
+// number of samples per pixel of the forward pass for the current anti-aliasing mode
+int Renderer::getAntiAliasingSamples() {
+	int modeSamples;
+
+	switch (antiAliasing) {
+	case msaa2:
+		modeSamples = 2;
+		break;
+
+	case msaa4:
+		modeSamples = 4;
+		break;
+
+	case msaa8:
+		modeSamples = 8;
+		break;
+
+	// no anti-aliasing, FXAA and TAA render a single sample
+	default:
+		modeSamples = 1;
+	}
+
+	return(std::min(modeSamples, this->maxSamples));
+}
+
+PostProcessing* Renderer::getPostProcessing() {
+	return(this->postProcessing);
+}
+
+RenderGraph* Renderer::getRenderGraph() {
+	return(this->renderGraph);
+}
+
+DebugDraw* Renderer::getDebugDraw() {
+	return(this->debugDraw);
+}
+
+DrawProfiler* Renderer::getDrawProfiler() {
+	return(this->drawProfiler);
+}
+
+FrameStats* Renderer::getFrameStats() {
+	return(this->frameStats);
+}
+
+MaterialTextures* Renderer::getMaterials() {
+	return(this->materials);
+}
+
+MeshPool* Renderer::getMeshPool() {
+	return(this->meshPool);
+}
+
+ShaderReloader* Renderer::getShaderReloader() {
+	return(this->shaderReloader);
+}
+
+// fraction of the screen resolution rendered by each spatial upscaling preset
+float Renderer::getUpscaleRenderScale() {
+	switch (upscaleQuality) {
+	case ultraQualityUpscaling:
+		return(0.77f);
+
+	case qualityUpscaling:
+		return(0.67f);
+
+	case balancedUpscaling:
+		return(0.59f);
+
+	case performanceUpscaling:
+		return(0.5f);
+
+	default:
+		return(1.0f);
+	}
+}
+
+double Renderer::getGPUFrameTime() {
+	return(this->renderGraph->getTimer()->getLastFrameTime());
+}
+
+double Renderer::getCPUFrameTime() {
+	return(this->cpuFrameTime);
+}
+
+double Renderer::getForwardGPUTime(int path) {
+	return(this->forwardGPUTime[path]);
+}
+
+double Renderer::getForwardCPUTime(int path) {
+	return(this->forwardCPUTime[path]);
+}
+
+int Renderer::getRenderWidth() {
+	return(this->renderWidth);
+}
+
+int Renderer::getRenderHeight() {
+	return(this->renderHeight);
+}
+
+int Renderer::getTargetWidth() {
+	return(this->targetWidth);
+}
+
+int Renderer::getTargetHeight() {
+	return(this->targetHeight);
+}
+
+double Renderer::getTAAPassTime(bool gpu) {
+	return(this->getPassTime({ "Temporal Anti-Aliasing" }, gpu));
+}
+
+double Renderer::getSSRPassTime(bool gpu) {
+	return(this->getPassTime({ "Screen Space Reflections" }, gpu));
+}
+
+unsigned int Renderer::getDepthBufferTexture() {
+	bool tmpVar = depthBuffer;
+
+	depthBuffer = true;
+	this->renderMultisamplePostProcessing();
+	depthBuffer = tmpVar;
+
+	glState->bindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	return(this->postProcessingTexture);
+}
+
@@ -1,77 +1,224 @@
-#ifndef __RENDERER__
-#define __RENDERER__
-#include <vector>
-#include "entity.h"
-#include "shader.h"
-
-// class for rendering entities using shaders (mainly openGL)
-class Renderer {
-	public:
-		// constructor method
-		Renderer();
-		// method for rendering
-		void render();
-
-		void setHighlightedEntity(int);
-
-		double getReflectionRenderTime();
-		double getForwardRenderTime();
-		double getMSPostProcessingPassTime();
-		double getPostProcessingPassTime();
-
-		unsigned int getOutlineMaskTexture();
-		unsigned int getDepthBufferTexture();
-		
-
-	private:
-		int highlightedEntity;
-		unsigned int tmpBuffer;
-
-		unsigned int reflectionFBO;
-		unsigned int reflectionRBO;
-		unsigned int reflectionCubemap;
-		int reflectionRes;
-
-		unsigned int screenFBO;
-		unsigned int screenTexture;
-		unsigned int screenDepthTexture;
-		unsigned int screenStencilTexture;
-		unsigned int screenRBO;
-		unsigned int screenVBO;
-		unsigned int screenUVVBO;
-		unsigned int outlineTextureMask;
-		unsigned int postProcessingFBO;
-		unsigned int postProcessingTexture;
-		unsigned int postProcessingTexture2;
-		unsigned int postProcessingDepthTexture;
-
-		Shader* postProcessingShader;
-		Shader* screenShader;
-		Shader* depthShader;
-
-		std::vector<float> data1;
-
-		double reflectionRenderTime;
-		double forwardRenderTime;
-		double MSPostProcessingPassTime;
-		double postProcessingPassTime;
-		
-		void renderReflectionCubemap();
-		void renderMultisamplePostProcessing();
-		void renderScreen();
-		void resetRender();
-		// method for updating the render resolution
-		void resizeScreen();
-		void renderEntities(bool);
-		void renderEntity(Entity*);
-		void attachUniforms(Entity *, std::vector<uniform_t>);
-		void linkLayouts(Entity*, std::vector<char *>);
-		void renderOutline();
-
-		void displayBoundingBox();
-		void drawBoundingBox(bounds_t, glm::vec3);
-		void drawBoundingSphere(float, glm::vec3, glm::vec3);
-		void createCube(std::vector<float>*, std::vector<glm::vec3>);
-		void createSphere(glm::vec3, float, int, std::vector<float>*);
-};
+#ifndef __RENDERER__
+#define __RENDERER__
+#include <vector>
+#include "entity.h"
+#include "shader.h"
+#include "postProcessing.h"
+#include "renderGraph.h"
+#include "debugDraw.h"
+#include "materialTextures.h"
+#include "meshPool.h"
+#include "shaderVariants.h"
+#include "shaderReloader.h"
+#include "drawProfiler.h"
+#include "frameStats.h"
+#include <glm\glm.hpp>
+
+// the outline distance field is computed at 1 / OUTLINE_DOWNSAMPLE of the render resolution
+#define OUTLINE_DOWNSAMPLE 2
+// widest outline in pixels the jump flood reaches
+#define OUTLINE_MAX_WIDTH 64
+// entities with their own id in the 8 bit stencil buffer (0 is the background), the ones after them write 0 and get
+// the wireframe outline when they're selected
+#define OUTLINE_STENCIL_IDS 255
+// the screen sized targets are allocated in multiples of this many pixels, so a window being resized only
+// reallocates them when it crosses a multiple
+#define RENDER_TARGET_SIZE_CLASS 256
+// seconds the window size has to stay the same before targets bigger than needed are shrunk
+#define RENDER_TARGET_SETTLE_TIME 0.5
+
+// class for rendering entities using shaders (mainly openGL)
+class Renderer {
+	public:
+		// constructor method
+		Renderer();
+		// method for rendering
+		void render();
+
+		void setHighlightedEntity(int);
+
+		// GPU (true) or CPU (false) time (s) of the passes in the last frame the render graph timer read
+		double getReflectionRenderTime(bool);
+		double getForwardRenderTime(bool);
+		double getMSPostProcessingPassTime(bool);
+		double getPostProcessingPassTime(bool);
+		double getSSRPassTime(bool);
+		double getTAAPassTime(bool);
+		int getAntiAliasingSamples();
+		// GPU time (s) of the last frame the render graph timer read, from the start of its first pass to the end of its last
+		double getGPUFrameTime();
+		// CPU time (s) spent in render() last frame
+		double getCPUFrameTime();
+		// average GPU and CPU time (s) of the forward pass entity draws, for the attribute (0) and vertex pulling (1) paths
+		double getForwardGPUTime(int);
+		double getForwardCPUTime(int);
+		float getUpscaleRenderScale();
+		int getRenderWidth();
+		int getRenderHeight();
+		int getTargetWidth();
+		int getTargetHeight();
+		PostProcessing* getPostProcessing();
+		RenderGraph* getRenderGraph();
+		DebugDraw* getDebugDraw();
+		DrawProfiler* getDrawProfiler();
+		FrameStats* getFrameStats();
+		MaterialTextures* getMaterials();
+		MeshPool* getMeshPool();
+		ShaderReloader* getShaderReloader();
+
+		unsigned int getDepthBufferTexture();
+		
+
+	private:
+		int highlightedEntity;
+		unsigned int tmpBuffer;
+
+		unsigned int reflectionFBO;
+		unsigned int reflectionRBO;
+		unsigned int reflectionCubemap;
+		int reflectionRes;
+		int maxSamples;
+
+		// resolution the scene is rendered at this frame, a corner of the screen sized targets (dynamic resolution)
+		int renderWidth;
+		int renderHeight;
+		// allocated size of the screen sized targets, the screen uses their bottom left corner
+		int targetWidth;
+		int targetHeight;
+		// time of the last window resize
+		double resizeTime;
+		double cpuFrameTime;
+		// last frame of the render graph timer the render scale was adjusted for
+		int scaledFrame;
+		// vertex path the entity draws of the frames in the timer ring used (by frame number), and the last frame read
+		int forwardPaths[GPU_TIMER_FRAMES];
+		int forwardFrame;
+		double forwardGPUTime[2];
+		double forwardCPUTime[2];
+		// vertex pulling is used by the entity draws of this frame
+		bool pulling;
+
+		unsigned int screenFBO;
+		unsigned int screenTexture;
+		unsigned int screenDepthTexture;
+		unsigned int screenStencilTexture;
+		unsigned int screenRBO;
+		unsigned int screenVBO;
+		unsigned int screenUVVBO;
+		unsigned int postProcessingFBO;
+		unsigned int postProcessingTexture;
+		unsigned int postProcessingTexture2;
+		unsigned int postProcessingDepthTexture;
+		unsigned int postProcessingDepthFBO;
+
+		// screen space reflection targets: hierarchical depth (closest depth per mip texel),
+		// reflective surface normals and the half resolution reflection result
+		unsigned int hiZFBO;
+		unsigned int hiZTexture;
+		int hiZLevels;
+		unsigned int ssrNormalFBO;
+		unsigned int ssrNormalTexture;
+		unsigned int ssrFBO;
+		unsigned int ssrTexture;
+
+		// temporal anti-aliasing targets: motion of the moving entities and the two history textures,
+		// written in turns, with the jitter of the frame and the unjittered camera of this and the last frame
+		unsigned int velocityFBO;
+		unsigned int velocityTexture;
+		unsigned int taaFBO[2];
+		unsigned int taaTexture[2];
+		int taaCurrent;
+		bool taaHistoryValid;
+		int jitterIndex;
+		glm::vec2 jitter;
+		glm::mat4 projection;
+		glm::mat4 previousViewProjection;
+
+		// reduced resolution jump flood targets of the outline, written in turns
+		unsigned int outlineFBO[2];
+		unsigned int outlineTexture[2];
+
+		// screen resolution output of the spatial upscaler
+		unsigned int upscaleFBO;
+		unsigned int upscaleTexture;
+
+		Shader* postProcessingShader;
+		// multisample resolve shaders, specialized on the sample count (SAMPLES)
+		ShaderVariants* screenShaders;
+		ShaderVariants* depthShaders;
+		// flat shader the entities are drawn with while their own shader is still compiling
+		Shader* fallbackShader;
+		Shader* fxaaShader;
+		Shader* hiZShader;
+		Shader* ssrNormalShader;
+		Shader* ssrShader;
+		Shader* ssrCompositeShader;
+		Shader* motionShader;
+		Shader* taaShader;
+		Shader* upscaleShader;
+		Shader* sharpenShader;
+		Shader* outlineSeedShader;
+		Shader* jumpFloodShader;
+		// specialized on the outline style (FADE)
+		ShaderVariants* outlineShaders;
+
+		// chain of effects applied to the final image
+		PostProcessing* postProcessing;
+		// passes of the frame and the textures between them, the targets above are assigned from it every frame
+		RenderGraph* renderGraph;
+		// bounding volumes, batched for the whole frame
+		DebugDraw* debugDraw;
+		// cost of every entity draw, when drawStatistics is on
+		DrawProfiler* drawProfiler;
+		// times of every frame, for percentiles and exports
+		FrameStats* frameStats;
+		// entity textures, selected by index in the shaders instead of being bound for every draw
+		MaterialTextures* materials;
+		// vertex data of the entities, for the vertex pulling path
+		MeshPool* meshPool;
+		// recompiles the shaders whose files changed
+		ShaderReloader* shaderReloader;
+
+		std::vector<float> data1;
+
+		// summed GPU or CPU time of the passes with the given names
+		double getPassTime(std::vector<std::string>, bool);
+		void renderReflectionCubemap();
+		void updateRenderScale();
+		void renderMultisamplePostProcessing();
+		// method for declaring the passes of the frame with the targets they use, culling and allocating them
+		void buildRenderGraph();
+		// method for resolving the multisampled depth of the forward pass into postProcessingDepthTexture
+		void resolveDepth();
+		void renderScreenSpaceReflection();
+		void renderTemporalAntiAliasing();
+		// method for (re)creating the temporal anti-aliasing history at the target size
+		void setupTemporalAntiAliasing();
+		float halton(int, int);
+		void renderUpscale();
+		// checks if the spatial upscaler runs this frame
+		bool isUpscaling();
+		void drawScreenQuad();
+		void renderScreen();
+		void resetRender();
+		// method for updating the render resolution
+		void resizeScreen();
+		// method for growing the targets when the screen doesn't fit anymore, or shrinking them once it stopped changing
+		void updateTargetSize();
+		int getSizeClass(int);
+		void renderEntities(bool);
+		void renderEntity(Entity*);
+		// methods for filling the uniform slots and linking the layout slots of a shader for an entity
+		void attachUniforms(Entity*, const int*);
+		void linkLayouts(Entity*, const int*);
+		void setupEntityDraw(Entity*);
+		void bindEntityTexture(Entity*);
+		void readForwardTime();
+		void bindEntityTextures(bool);
+		bool usesMaterials(Shader*);
+		void renderOutline();
+		int getStencilID(int);
+
+		void displayBoundingBox();
+};
 #endif
\ No newline at end of file
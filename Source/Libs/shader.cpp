@@ -1,175 +1,775 @@
-#include "glad\glad.h"
-#include <string.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <iostream>
-#include <fstream>
-#include <sstream>
-#include "shader.h"
-
-// constructor method, sets the shader name
-Shader::Shader(char* name) {
-	this->name = name;
-}
-
-
-char* Shader::getName() {
-	return(this->name);
-}
-
-unsigned int Shader::getID() {
-	return(this->id);
-}
-
-std::vector<uniform_t> Shader::getUniformBuffer() {
-	return(this->uniformBuffer);
-}
-
-std::vector<char*> Shader::getLayoutBuffer() {
-	return(this->layoutBuffer);
-}
-
-void Shader::loadShader(char* vertex, char* fragment) {
-	this->id = compileShader(vertex, fragment);
-	findUniformAndLayouts(vertex);
-}
-
-unsigned int Shader::compileShader(char* vertex_file_path, char* fragment_file_path) {
-	// Create the shaders
-	GLuint VertexShaderID = glCreateShader(GL_VERTEX_SHADER);
-	GLuint FragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
-
-	// Read the Vertex Shader code from the file
-	std::string VertexShaderCode;
-	std::ifstream VertexShaderStream(vertex_file_path, std::ios::in);
-	if (VertexShaderStream.is_open()) {
-		std::stringstream sstr;
-		sstr << VertexShaderStream.rdbuf();
-		VertexShaderCode = sstr.str();
-		VertexShaderStream.close();
-	}
-	else {
-		printf("Impossible to open %s. Are you in the right directory ? Don't forget to read the FAQ !\n", vertex_file_path);
-		getchar();
-		return 0;
-	}
-
-	// Read the Fragment Shader code from the file
-	std::string FragmentShaderCode;
-	std::ifstream FragmentShaderStream(fragment_file_path, std::ios::in);
-	if (FragmentShaderStream.is_open()) {
-		std::stringstream sstr;
-		sstr << FragmentShaderStream.rdbuf();
-		FragmentShaderCode = sstr.str();
-		FragmentShaderStream.close();
-	}
-
-	GLint Result = GL_FALSE;
-	int InfoLogLength;
-
-	// Compile Vertex Shader
-	printf("Compiling shader : %s\n", vertex_file_path);
-	char const* VertexSourcePointer = VertexShaderCode.c_str();
-	glShaderSource(VertexShaderID, 1, &VertexSourcePointer, NULL);
-	glCompileShader(VertexShaderID);
-
-	// Check Vertex Shader
-	glGetShaderiv(VertexShaderID, GL_COMPILE_STATUS, &Result);
-	glGetShaderiv(VertexShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
-	if (InfoLogLength > 0) {
-		std::vector<char> VertexShaderErrorMessage(InfoLogLength + 1);
-		glGetShaderInfoLog(VertexShaderID, InfoLogLength, NULL, &VertexShaderErrorMessage[0]);
-		printf("%s\n", &VertexShaderErrorMessage[0]);
-	}
-
-	// Compile Fragment Shader
-	printf("Compiling shader : %s\n", fragment_file_path);
-	char const* FragmentSourcePointer = FragmentShaderCode.c_str();
-	glShaderSource(FragmentShaderID, 1, &FragmentSourcePointer, NULL);
-	glCompileShader(FragmentShaderID);
-
-	// Check Fragment Shader
-	glGetShaderiv(FragmentShaderID, GL_COMPILE_STATUS, &Result);
-	glGetShaderiv(FragmentShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
-	if (InfoLogLength > 0) {
-		std::vector<char> FragmentShaderErrorMessage(InfoLogLength + 1);
-		glGetShaderInfoLog(FragmentShaderID, InfoLogLength, NULL, &FragmentShaderErrorMessage[0]);
-		printf("%s\n", &FragmentShaderErrorMessage[0]);
-	}
-
-	// Link the program
-	printf("Linking program\n");
-	GLuint ProgramID = glCreateProgram();
-	glAttachShader(ProgramID, VertexShaderID);
-	glAttachShader(ProgramID, FragmentShaderID);
-	glLinkProgram(ProgramID);
-
-	// Check the program
-	glGetProgramiv(ProgramID, GL_LINK_STATUS, &Result);
-	glGetProgramiv(ProgramID, GL_INFO_LOG_LENGTH, &InfoLogLength);
-	if (InfoLogLength > 0) {
-		std::vector<char> ProgramErrorMessage(InfoLogLength + 1);
-		glGetProgramInfoLog(ProgramID, InfoLogLength, NULL, &ProgramErrorMessage[0]);
-		printf("%s\n", &ProgramErrorMessage[0]);
-	}
-
-	glDetachShader(ProgramID, VertexShaderID);
-	glDetachShader(ProgramID, FragmentShaderID);
-
-	glDeleteShader(VertexShaderID);
-	glDeleteShader(FragmentShaderID);
-
-	return ProgramID;
-	//return(0);
-}
-
-void Shader::findUniformAndLayouts(char* shader) {
-	FILE* vertexShader = fopen(shader, "r");
-	int readingUniform = 0;
-	int readingLayouts = 0;
-	char buffer[255];
-	uniform_t tmpUniform;
-	tmpUniform.id = 0;
-	tmpUniform.name = (char*)calloc(sizeof(char), 255);
-	tmpUniform.type = (char*)calloc(sizeof(char), 255);
-	char* tmpLayout = (char*)calloc(sizeof(char), 255);
-
-	if (vertexShader == NULL) {
-		printf("COULD NOT LOAD SHADER\n");
-	}
-
-	while (fscanf(vertexShader, "%s", buffer) != EOF) {
-
-		if (readingUniform) {
-			if (readingUniform == 2) {
-				strcpy(tmpUniform.type, buffer);
-			}
-
-			else if (readingUniform == 1) {
-				strcpy(tmpUniform.name, buffer);
-				tmpUniform.id = glGetUniformLocation(this->id, tmpUniform.name);
-				this->uniformBuffer.push_back(tmpUniform);
-				tmpUniform.name = (char*)calloc(sizeof(char), 255);
-				tmpUniform.type = (char*)calloc(sizeof(char), 255);
-			}
-			readingUniform--;
-		}
-
-		if (readingLayouts) {
-			if (readingLayouts == 1) {
-				strcpy(tmpLayout, buffer);
-				this->layoutBuffer.push_back(&tmpLayout[0]);
-				tmpLayout = (char*)calloc(sizeof(char), 255);
-			}
-			readingLayouts--;
-		}
-
-		if (!strcmp(buffer, "uniform")) {
-			readingUniform = 2;
-		}
-
-		if (!strcmp(buffer, "layout")) {
-			readingLayouts = 6;
-		}
-	}
-}
+#include "glad\glad.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include "shader.h"
+#include "meshPool.h"
+#include "init.h"
+
+// KHR_parallel_shader_compile isn't part of the loader, its entry point is looked up when the driver has it
+// (ARB_parallel_shader_compile is the same extension with another suffix)
+#define GL_COMPLETION_STATUS 0x91B1
+
+typedef void (APIENTRYP maxShaderCompilerThreads_t)(GLuint);
+
+static maxShaderCompilerThreads_t maxShaderCompilerThreads = NULL;
+static bool parallelCompileChecked = false;
+static bool parallelCompile = false;
+
+// names of the uniform and layout slots in the shaders, in the order of uniformSlot_t and layoutSlot_t
+static const char* uniformSlotNames[uniformSlotCount] = {
+	"modelMatrix",
+	"viewMatrix",
+	"projectionMatrix",
+	"lightPosition",
+	"eyePosition",
+	"meshOffsets",
+	"materialIndex"
+};
+
+static const char* layoutSlotNames[layoutSlotCount] = {
+	"vertex",
+	"uv",
+	"color",
+	"normal"
+};
+
+// constructor method, sets the shader name
+Shader::Shader(char* name) {
+	this->name = name;
+	this->screenSpaceReflection = false;
+	this->reflectivity = 1.0f;
+	this->id = 0;
+	this->pullingID = 0;
+	this->vertexPath = NULL;
+	this->fragmentPath = NULL;
+	this->ready = false;
+	this->failed = false;
+	this->pending.program = 0;
+	this->pending.vertex = 0;
+	this->pending.fragment = 0;
+	this->reloadID = 0;
+	this->pendingReload = this->pending;
+	this->pendingPulling = this->pending;
+	this->pullingFailed = false;
+
+	for (int i = 0; i < uniformSlotCount; i++) {
+		this->uniformSlots[i] = -1;
+		this->pullingUniformSlots[i] = -1;
+	}
+
+	for (int i = 0; i < layoutSlotCount; i++) {
+		this->layoutSlots[i] = -1;
+	}
+}
+
+Shader::Shader(char* name, std::string defines) : Shader(name) {
+	this->defines = defines;
+}
+
+
+char* Shader::getName() {
+	return(this->name);
+}
+
+unsigned int Shader::getID() {
+	return(this->id);
+}
+
+std::vector<uniform_t> Shader::getUniformBuffer() {
+	return(this->uniformBuffer);
+}
+
+// the first call submits the program and the next ones poll it like the startup programs, 0 is returned until it's
+// done (or when it failed) and the entities are drawn with their attributes meanwhile
+unsigned int Shader::getPullingID() {
+	if (this->pullingID != 0 || this->pullingFailed || this->vertexPath == NULL || !this->ready || this->failed) {
+		return(this->pullingID);
+	}
+
+	if (this->pendingPulling.program == 0) {
+		std::string vertexCode = this->createPullingVertexCode(readShaderFile(this->vertexPath));
+		std::string fragmentCode = this->fragmentPath != NULL ? readShaderFile(this->fragmentPath) : this->fragmentCode;
+
+		this->pendingPulling = submitShaderCode(this->vertexPath, vertexCode, this->name, fragmentCode);
+
+		return(0);
+	}
+
+	if (hasParallelCompile() && this->pendingPulling.vertex != 0) {
+		GLint done = GL_FALSE;
+		glGetProgramiv(this->pendingPulling.program, GL_COMPLETION_STATUS, &done);
+
+		if (done != GL_TRUE) {
+			return(0);
+		}
+	}
+
+	// the log shown in the ui stays the one of the attribute version
+	std::string log = this->log;
+	unsigned int program = this->pendingPulling.program;
+	this->pendingPulling.program = 0;
+
+	if (!finishShaderCode(&this->pendingPulling)) {
+		printf("vertex pulling version of %s failed, drawing it with attributes\n", this->name);
+		glDeleteProgram(program);
+		this->pullingFailed = true;
+		this->log = log;
+		return(0);
+	}
+
+	this->log = log;
+	this->pullingID = program;
+
+	// the same uniforms as the attribute version at the locations they got in this program, plus meshOffsets
+	std::vector<uniform_t> pullingUniforms;
+	reflectProgram(this->pullingID, &pullingUniforms, this->pullingUniformSlots, NULL);
+
+	return(this->pullingID);
+}
+
+const int* Shader::getUniformSlots() {
+	return(this->uniformSlots);
+}
+
+const int* Shader::getPullingUniformSlots() {
+	return(this->pullingUniformSlots);
+}
+
+const int* Shader::getLayoutSlots() {
+	return(this->layoutSlots);
+}
+
+bool Shader::hasUniform(uniformSlot_t slot) {
+	return(this->uniformSlots[slot] >= 0);
+}
+
+bool Shader::getScreenSpaceReflection() {
+	return(this->screenSpaceReflection);
+}
+
+float Shader::getReflectivity() {
+	return(this->reflectivity);
+}
+
+void Shader::setScreenSpaceReflection(bool screenSpaceReflection) {
+	this->screenSpaceReflection = screenSpaceReflection;
+}
+
+void Shader::setReflectivity(float reflectivity) {
+	this->reflectivity = reflectivity;
+}
+
+void Shader::loadShader(char* vertex, char* fragment) {
+	this->vertexPath = vertex;
+	this->fragmentPath = fragment;
+	this->id = compileShader(vertex, fragment);
+	reflectProgram(this->id, &this->uniformBuffer, this->uniformSlots, this->layoutSlots);
+	this->ready = true;
+	this->failed = this->id == 0;
+}
+
+// same as loadShader without waiting for the driver: the program is finished by poll once it's done, so every
+// shader of a batch can be submitted before any of them is waited on
+void Shader::submitShader(char* vertex, char* fragment) {
+	// sets the compiler threads before the first submission
+	hasParallelCompile();
+
+	std::string vertexCode = readShaderFile(vertex);
+
+	if (vertexCode.empty()) {
+		this->id = 0;
+		return;
+	}
+
+	this->vertexPath = vertex;
+	this->fragmentPath = fragment;
+	this->pending = submitShaderCode(vertex, vertexCode, fragment, readShaderFile(fragment));
+	this->id = this->pending.program;
+}
+
+// without the extension the status can't be asked without waiting, so the program is finished right away
+bool Shader::poll() {
+	if (this->ready || this->id == 0) {
+		return(this->ready);
+	}
+
+	if (hasParallelCompile() && this->pending.vertex != 0) {
+		GLint done = GL_FALSE;
+		glGetProgramiv(this->id, GL_COMPLETION_STATUS, &done);
+
+		if (done != GL_TRUE) {
+			return(false);
+		}
+	}
+
+	// the log of a program that failed stays for the ui, the program is kept so a reload can replace it
+	this->failed = !finishShaderCode(&this->pending);
+
+	if (!this->failed) {
+		reflectProgram(this->id, &this->uniformBuffer, this->uniformSlots, this->layoutSlots);
+	}
+
+	this->ready = true;
+
+	return(true);
+}
+
+bool Shader::isReady() {
+	return(this->ready);
+}
+
+bool Shader::hasFailed() {
+	return(this->failed);
+}
+
+// the new program is submitted like the startup ones, so the frames keep drawing with the old one while it compiles
+bool Shader::reload() {
+	if (this->vertexPath == NULL || this->reloadID != 0 || !this->ready) {
+		return(false);
+	}
+
+	std::string vertexCode = readShaderFile(this->vertexPath);
+	std::string fragmentCode = this->fragmentPath != NULL ? readShaderFile(this->fragmentPath) : this->fragmentCode;
+
+	if (vertexCode.empty() || fragmentCode.empty()) {
+		this->log = "impossible to read the sources\n";
+		return(false);
+	}
+
+	this->pendingReload = submitShaderCode(this->vertexPath, vertexCode, this->fragmentPath != NULL ? this->fragmentPath : this->name, fragmentCode);
+	this->reloadID = this->pendingReload.program;
+
+	return(true);
+}
+
+// the old program is only deleted once the new one linked, so a shader with errors keeps drawing as it was
+int Shader::pollReload() {
+	if (this->reloadID == 0) {
+		return(0);
+	}
+
+	if (hasParallelCompile() && this->pendingReload.vertex != 0) {
+		GLint done = GL_FALSE;
+		glGetProgramiv(this->reloadID, GL_COMPLETION_STATUS, &done);
+
+		if (done != GL_TRUE) {
+			return(0);
+		}
+	}
+
+	unsigned int program = this->reloadID;
+	this->reloadID = 0;
+
+	if (!finishShaderCode(&this->pendingReload)) {
+		glDeleteProgram(program);
+		return(-1);
+	}
+
+	glState->forgetProgram(this->id);
+	glDeleteProgram(this->id);
+	this->id = program;
+	this->failed = false;
+
+	// the vertex pulling version is built again from the new sources the next time it's asked for
+	if (this->pullingID != 0) {
+		glState->forgetProgram(this->pullingID);
+		glDeleteProgram(this->pullingID);
+		this->pullingID = 0;
+	}
+
+	// a pulling version still compiling is built from the old sources, the shaders go with the program
+	if (this->pendingPulling.program != 0) {
+		glDeleteShader(this->pendingPulling.vertex);
+		glDeleteShader(this->pendingPulling.fragment);
+		glDeleteProgram(this->pendingPulling.program);
+		this->pendingPulling.program = 0;
+		this->pendingPulling.vertex = 0;
+		this->pendingPulling.fragment = 0;
+		this->pendingPulling.sources.clear();
+	}
+
+	this->pullingFailed = false;
+
+	reflectProgram(this->id, &this->uniformBuffer, this->uniformSlots, this->layoutSlots);
+
+	return(1);
+}
+
+bool Shader::isReloading() {
+	return(this->reloadID != 0);
+}
+
+char* Shader::getVertexPath() {
+	return(this->vertexPath);
+}
+
+char* Shader::getFragmentPath() {
+	return(this->fragmentPath);
+}
+
+std::string Shader::getLog() {
+	return(this->log);
+}
+
+// asks the driver for as many compiler threads as it can use, the first time it's checked
+bool Shader::hasParallelCompile() {
+	if (parallelCompileChecked) {
+		return(parallelCompile);
+	}
+
+	parallelCompileChecked = true;
+
+	if (glfwExtensionSupported("GL_KHR_parallel_shader_compile")) {
+		maxShaderCompilerThreads = (maxShaderCompilerThreads_t)glfwGetProcAddress("glMaxShaderCompilerThreadsKHR");
+	}
+	else if (glfwExtensionSupported("GL_ARB_parallel_shader_compile")) {
+		maxShaderCompilerThreads = (maxShaderCompilerThreads_t)glfwGetProcAddress("glMaxShaderCompilerThreadsARB");
+	}
+
+	parallelCompile = maxShaderCompilerThreads != NULL;
+
+	if (parallelCompile) {
+		maxShaderCompilerThreads(0xFFFFFFFF);
+	}
+
+	printf("parallel shader compile: %s\n", parallelCompile ? "yes" : "no (programs are finished when first polled)");
+
+	return(parallelCompile);
+}
+
+// same as loadShader, with the fragment shader code generated at runtime instead of read from a file
+void Shader::loadShader(char* vertex, std::string fragmentCode) {
+	std::string vertexCode = readShaderFile(vertex);
+
+	if (vertexCode.empty()) {
+		this->id = 0;
+		return;
+	}
+
+	this->vertexPath = vertex;
+	this->fragmentCode = fragmentCode;
+	this->id = compileShaderCode(vertex, vertexCode, this->name, fragmentCode);
+	reflectProgram(this->id, &this->uniformBuffer, this->uniformSlots, this->layoutSlots);
+	this->ready = true;
+	this->failed = this->id == 0;
+}
+
+// compute programs have no layouts and their uniforms are set by whoever dispatches them, so nothing is parsed
+void Shader::loadComputeShader(char* compute) {
+	this->id = compileComputeShader(compute);
+	this->ready = true;
+}
+
+std::string Shader::readShaderFile(char* file_path) {
+	std::string code;
+	std::ifstream stream(file_path, std::ios::in);
+
+	if (stream.is_open()) {
+		std::stringstream sstr;
+		sstr << stream.rdbuf();
+		code = sstr.str();
+		stream.close();
+	}
+	else {
+		printf("Impossible to open %s. Are you in the right directory ? Don't forget to read the FAQ !\n", file_path);
+	}
+
+	return(code);
+}
+
+// the defines have to follow the version, which has to be the first line of the code
+std::string Shader::specialize(std::string code) {
+	if (this->defines.empty()) {
+		return(code);
+	}
+
+	size_t version = code.find("#version");
+
+	if (version == std::string::npos) {
+		return(this->defines + code);
+	}
+
+	size_t lineEnd = code.find('\n', version);
+
+	if (lineEnd == std::string::npos) {
+		return(code + "\n" + this->defines);
+	}
+
+	return(code.substr(0, lineEnd + 1) + this->defines + code.substr(lineEnd + 1));
+}
+
+unsigned int Shader::compileShader(char* vertex_file_path, char* fragment_file_path) {
+	// Read the Vertex Shader code from the file
+	std::string VertexShaderCode = readShaderFile(vertex_file_path);
+
+	if (VertexShaderCode.empty()) {
+		getchar();
+		return 0;
+	}
+
+	// Read the Fragment Shader code from the file
+	std::string FragmentShaderCode = readShaderFile(fragment_file_path);
+
+	return(compileShaderCode(vertex_file_path, VertexShaderCode, fragment_file_path, FragmentShaderCode));
+}
+
+unsigned int Shader::compileShaderCode(char* vertex_file_path, std::string VertexShaderCode, char* fragment_file_path, std::string FragmentShaderCode) {
+	pendingProgram_t Program = submitShaderCode(vertex_file_path, VertexShaderCode, fragment_file_path, FragmentShaderCode);
+	unsigned int ProgramID = Program.program;
+
+	// a program that didn't compile or link can't be used, 0 makes the caller fall back
+	if (!finishShaderCode(&Program)) {
+		glDeleteProgram(ProgramID);
+		return 0;
+	}
+
+	return ProgramID;
+}
+
+// only hands the work to the driver: nothing is queried, so the compilation of every submitted program can overlap
+pendingProgram_t Shader::submitShaderCode(char* vertex_file_path, std::string VertexShaderCode, char* fragment_file_path, std::string FragmentShaderCode) {
+	PROFILE_ZONE("Shader::submitShaderCode");
+
+	double setupTime = glfwGetTime();
+
+	pendingProgram_t Program;
+	Program.vertex = 0;
+	Program.fragment = 0;
+
+	VertexShaderCode = specialize(VertexShaderCode);
+	FragmentShaderCode = specialize(FragmentShaderCode);
+
+	// Restore the program from the shader cache if these sources were linked on a previous launch
+	Program.sources = VertexShaderCode + std::string(1, '\0') + FragmentShaderCode;
+	Program.program = shaderCache->loadProgram(Program.sources);
+
+	if (Program.program != 0) {
+		printf("Loading cached program : %s\n", vertex_file_path);
+		shaderCache->addSetupTime(setupTime, glfwGetTime());
+		return Program;
+	}
+
+	// Create the shaders
+	GLuint VertexShaderID = glCreateShader(GL_VERTEX_SHADER);
+	GLuint FragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
+
+	// Compile Vertex Shader
+	printf("Compiling shader : %s\n", vertex_file_path);
+	char const* VertexSourcePointer = VertexShaderCode.c_str();
+	glShaderSource(VertexShaderID, 1, &VertexSourcePointer, NULL);
+	glCompileShader(VertexShaderID);
+
+	// Compile Fragment Shader
+	printf("Compiling shader : %s\n", fragment_file_path);
+	char const* FragmentSourcePointer = FragmentShaderCode.c_str();
+	glShaderSource(FragmentShaderID, 1, &FragmentSourcePointer, NULL);
+	glCompileShader(FragmentShaderID);
+
+	// Link the program
+	GLuint ProgramID = glCreateProgram();
+	glAttachShader(ProgramID, VertexShaderID);
+	glAttachShader(ProgramID, FragmentShaderID);
+	glProgramParameteri(ProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	glLinkProgram(ProgramID);
+
+	Program.program = ProgramID;
+	Program.vertex = VertexShaderID;
+	Program.fragment = FragmentShaderID;
+
+	shaderCache->addSetupTime(setupTime, glfwGetTime());
+
+	return Program;
+}
+
+// the status queries wait for the driver, so this is only called once the program is done (or when waiting is fine)
+bool Shader::finishShaderCode(pendingProgram_t* Program) {
+	PROFILE_ZONE("Shader::finishShaderCode");
+
+	// a cached program has nothing left to check
+	if (Program->vertex == 0) {
+		this->log.clear();
+		return(true);
+	}
+
+	double setupTime = glfwGetTime();
+
+	this->log.clear();
+
+	GLuint ProgramID = Program->program;
+	GLuint VertexShaderID = Program->vertex;
+	GLuint FragmentShaderID = Program->fragment;
+
+	GLint Result = GL_FALSE;
+	int InfoLogLength;
+
+	// Check Vertex Shader
+	glGetShaderiv(VertexShaderID, GL_COMPILE_STATUS, &Result);
+	glGetShaderiv(VertexShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
+	if (InfoLogLength > 0) {
+		std::vector<char> VertexShaderErrorMessage(InfoLogLength + 1);
+		glGetShaderInfoLog(VertexShaderID, InfoLogLength, NULL, &VertexShaderErrorMessage[0]);
+		printf("%s\n", &VertexShaderErrorMessage[0]);
+		this->log += std::string("vertex: ") + &VertexShaderErrorMessage[0] + "\n";
+	}
+
+	// Check Fragment Shader
+	glGetShaderiv(FragmentShaderID, GL_COMPILE_STATUS, &Result);
+	glGetShaderiv(FragmentShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
+	if (InfoLogLength > 0) {
+		std::vector<char> FragmentShaderErrorMessage(InfoLogLength + 1);
+		glGetShaderInfoLog(FragmentShaderID, InfoLogLength, NULL, &FragmentShaderErrorMessage[0]);
+		printf("%s\n", &FragmentShaderErrorMessage[0]);
+		this->log += std::string("fragment: ") + &FragmentShaderErrorMessage[0] + "\n";
+	}
+
+	// Check the program
+	printf("Linking program : %s\n", this->name);
+	glGetProgramiv(ProgramID, GL_LINK_STATUS, &Result);
+	glGetProgramiv(ProgramID, GL_INFO_LOG_LENGTH, &InfoLogLength);
+	if (InfoLogLength > 0) {
+		std::vector<char> ProgramErrorMessage(InfoLogLength + 1);
+		glGetProgramInfoLog(ProgramID, InfoLogLength, NULL, &ProgramErrorMessage[0]);
+		printf("%s\n", &ProgramErrorMessage[0]);
+		this->log += std::string("link: ") + &ProgramErrorMessage[0] + "\n";
+	}
+
+	if (Result == GL_TRUE) {
+		shaderCache->saveProgram(Program->sources, ProgramID);
+	}
+
+	glDetachShader(ProgramID, VertexShaderID);
+	glDetachShader(ProgramID, FragmentShaderID);
+
+	glDeleteShader(VertexShaderID);
+	glDeleteShader(FragmentShaderID);
+
+	Program->vertex = 0;
+	Program->fragment = 0;
+	Program->sources.clear();
+
+	shaderCache->addSetupTime(setupTime, glfwGetTime());
+
+	return(Result == GL_TRUE);
+}
+
+unsigned int Shader::compileComputeShader(char* compute_file_path) {
+	PROFILE_ZONE("Shader::compileComputeShader");
+
+	std::string ComputeShaderCode = readShaderFile(compute_file_path);
+
+	if (ComputeShaderCode.empty()) {
+		return 0;
+	}
+
+	double setupTime = glfwGetTime();
+
+	// Restore the program from the shader cache if this source was linked on a previous launch
+	GLuint CachedProgramID = shaderCache->loadProgram(ComputeShaderCode);
+
+	if (CachedProgramID != 0) {
+		printf("Loading cached program : %s\n", compute_file_path);
+		shaderCache->addSetupTime(setupTime, glfwGetTime());
+		return CachedProgramID;
+	}
+
+	GLuint ComputeShaderID = glCreateShader(GL_COMPUTE_SHADER);
+
+	GLint Result = GL_FALSE;
+	int InfoLogLength;
+
+	// Compile Compute Shader
+	printf("Compiling shader : %s\n", compute_file_path);
+	char const* ComputeSourcePointer = ComputeShaderCode.c_str();
+	glShaderSource(ComputeShaderID, 1, &ComputeSourcePointer, NULL);
+	glCompileShader(ComputeShaderID);
+
+	// Check Compute Shader
+	glGetShaderiv(ComputeShaderID, GL_COMPILE_STATUS, &Result);
+	glGetShaderiv(ComputeShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
+	if (InfoLogLength > 0) {
+		std::vector<char> ComputeShaderErrorMessage(InfoLogLength + 1);
+		glGetShaderInfoLog(ComputeShaderID, InfoLogLength, NULL, &ComputeShaderErrorMessage[0]);
+		printf("%s\n", &ComputeShaderErrorMessage[0]);
+	}
+
+	// Link the program
+	printf("Linking program\n");
+	GLuint ProgramID = glCreateProgram();
+	glAttachShader(ProgramID, ComputeShaderID);
+	glProgramParameteri(ProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	glLinkProgram(ProgramID);
+
+	// Check the program
+	glGetProgramiv(ProgramID, GL_LINK_STATUS, &Result);
+	glGetProgramiv(ProgramID, GL_INFO_LOG_LENGTH, &InfoLogLength);
+	if (InfoLogLength > 0) {
+		std::vector<char> ProgramErrorMessage(InfoLogLength + 1);
+		glGetProgramInfoLog(ProgramID, InfoLogLength, NULL, &ProgramErrorMessage[0]);
+		printf("%s\n", &ProgramErrorMessage[0]);
+	}
+
+	if (Result == GL_TRUE) {
+		shaderCache->saveProgram(ComputeShaderCode, ProgramID);
+	}
+
+	glDetachShader(ProgramID, ComputeShaderID);
+	glDeleteShader(ComputeShaderID);
+
+	shaderCache->addSetupTime(setupTime, glfwGetTime());
+
+	return ProgramID;
+}
+
+// the layouts become globals filled at the start of main from the mesh buffer (see MeshPool), indexed by gl_VertexID
+// and the offsets of the mesh being drawn: vertex and normal from their own data, uv and color from the uv data
+std::string Shader::createPullingVertexCode(std::string code) {
+	std::istringstream lines(code);
+	std::string line;
+	std::string version;
+	std::string body;
+	std::string fetches;
+
+	while (std::getline(lines, line)) {
+		std::istringstream tokens(line);
+		std::string token;
+		std::vector<std::string> words;
+
+		while (tokens >> token) {
+			words.push_back(token);
+		}
+
+		// storage buffers need GLSL 4.30 or the extension on older contexts, the profile is kept
+		if (words.size() >= 2 && words[0] == "#version") {
+			std::string profile = words.size() >= 3 ? " " + words[2] : "";
+
+			if (GLAD_GL_VERSION_4_3) {
+				version = "#version " + std::to_string(std::max(atoi(words[1].c_str()), 430)) + profile + "\n";
+			}
+			else {
+				version = "#version " + words[1] + profile + "\n#extension GL_ARB_shader_storage_buffer_object : require\n";
+			}
+
+			continue;
+		}
+
+		// layout (location = N) in type name ;
+		std::vector<std::string>::iterator in = std::find(words.begin(), words.end(), "in");
+
+		if (words.size() > 0 && words[0].compare(0, 6, "layout") == 0 && words.end() - in >= 3) {
+			std::string type = *(in + 1);
+			std::string name = *(in + 2);
+
+			if (name[name.size() - 1] == ';') {
+				name.erase(name.size() - 1);
+			}
+
+			body += type + " " + name + ";\n";
+
+			if (name == "vertex" || name == "normal" || name == "color") {
+				std::string offset = name == "vertex" ? "meshOffsets.x" : name == "normal" ? "meshOffsets.z" : "meshOffsets.y";
+				fetches += "  " + name + " = vec3(meshData[" + offset + " + 3 * gl_VertexID], meshData[" + offset +
+					" + 3 * gl_VertexID + 1], meshData[" + offset + " + 3 * gl_VertexID + 2]);\n";
+			}
+			else if (name == "uv") {
+				fetches += "  uv = vec2(meshData[meshOffsets.y + 2 * gl_VertexID], meshData[meshOffsets.y + 2 * gl_VertexID + 1]);\n";
+			}
+
+			continue;
+		}
+
+		// the original main runs after the fetches
+		size_t main = line.find("void main(");
+
+		if (main != std::string::npos) {
+			line.replace(main, 10, "void entityMain(");
+		}
+
+		body += line + "\n";
+	}
+
+	std::string meshBuffer = "layout (std430, binding = " + std::to_string(MESH_BUFFER_BINDING) +
+		") readonly buffer meshBuffer {\n  float meshData[];\n};\n\nuniform ivec3 meshOffsets;\n\n";
+	std::string main = "\nvoid main() {\n" + fetches + "  entityMain();\n}\n";
+
+	return(version + meshBuffer + body + main);
+}
+
+// uniforms in blocks have no location and are skipped, arrays are reported with a [0] suffix that's removed
+void Shader::reflectProgram(unsigned int program, std::vector<uniform_t>* uniforms, int* uniformSlots, int* layoutSlots) {
+	for (int i = 0; i < uniformSlotCount; i++) {
+		uniformSlots[i] = -1;
+	}
+
+	for (int i = 0; layoutSlots != NULL && i < layoutSlotCount; i++) {
+		layoutSlots[i] = -1;
+	}
+
+	uniforms->clear();
+
+	if (program == 0) {
+		return;
+	}
+
+	GLint count = 0;
+	GLint nameLength = 0;
+	glGetProgramInterfaceiv(program, GL_UNIFORM, GL_ACTIVE_RESOURCES, &count);
+	glGetProgramInterfaceiv(program, GL_UNIFORM, GL_MAX_NAME_LENGTH, &nameLength);
+
+	std::vector<char> name(std::max(nameLength, 1));
+	const GLenum uniformProperties[2] = { GL_TYPE, GL_LOCATION };
+
+	for (int i = 0; i < count; i++) {
+		GLint values[2];
+		glGetProgramResourceiv(program, GL_UNIFORM, i, 2, uniformProperties, 2, NULL, values);
+
+		if (values[1] < 0) {
+			continue;
+		}
+
+		glGetProgramResourceName(program, GL_UNIFORM, i, name.size(), NULL, &name[0]);
+
+		uniform_t uniform;
+		uniform.id = values[1];
+		uniform.type = values[0];
+		uniform.name = &name[0];
+
+		if (uniform.name.size() > 3 && uniform.name.compare(uniform.name.size() - 3, 3, "[0]") == 0) {
+			uniform.name.erase(uniform.name.size() - 3);
+		}
+
+		uniforms->push_back(uniform);
+
+		for (int j = 0; j < uniformSlotCount; j++) {
+			if (uniform.name == uniformSlotNames[j]) {
+				uniformSlots[j] = uniform.id;
+			}
+		}
+	}
+
+	if (layoutSlots == NULL) {
+		return;
+	}
+
+	glGetProgramInterfaceiv(program, GL_PROGRAM_INPUT, GL_ACTIVE_RESOURCES, &count);
+	glGetProgramInterfaceiv(program, GL_PROGRAM_INPUT, GL_MAX_NAME_LENGTH, &nameLength);
+
+	name.resize(std::max(nameLength, 1));
+	const GLenum inputProperties[1] = { GL_LOCATION };
+
+	for (int i = 0; i < count; i++) {
+		GLint location;
+		glGetProgramResourceiv(program, GL_PROGRAM_INPUT, i, 1, inputProperties, 1, NULL, &location);
+		glGetProgramResourceName(program, GL_PROGRAM_INPUT, i, name.size(), NULL, &name[0]);
+
+		for (int j = 0; j < layoutSlotCount; j++) {
+			if (strcmp(&name[0], layoutSlotNames[j]) == 0) {
+				layoutSlots[j] = location;
+			}
+		}
+	}
+}
@@ -1,46 +1,162 @@
-#ifndef __SHADER__
-#define __SHADER__
-
-#include <vector>
-
-// struct for saving the informations about shader uniforms
-typedef struct {
-	unsigned int id;
-	char* type;
-	char* name;
-} uniform_t;
-
-// class for loading, storing and dealing with shaders
-class Shader {
-	public:
-		// constructor method
-		Shader(char*);
-		// public method for loading vertex and fragment shaders
-		void loadShader(char*, char*);
-
-		// get method for getting the shader id
-		unsigned int getID();
-		// get method for getting the shader name
-		char* getName();
-		// get method for getting the buffer containing all the uniforms of the shader
-		std::vector<uniform_t> getUniformBuffer();
-		// get method for getting the buffer containing all the layouts of the shader
-		std::vector<char*> getLayoutBuffer();
-		
-	private:
-		// shader name
-		char* name;
-		// shader id
-		unsigned int id;
-		// buffer containing the shader uniforms information
-		std::vector<uniform_t> uniformBuffer;
-		// buffer containing the shader layout information
-		std::vector<char*> layoutBuffer;
-		
-		// method for compiling shader code
-		unsigned int compileShader(char*, char*);
-		// method for reading the shader code and finding uniforms and layouts, to store them in the relative shaders
-		void findUniformAndLayouts(char*);
-};
-
-#endif
+#ifndef __SHADER__
+#define __SHADER__
+
+#include <vector>
+#include <string>
+
+// uniforms the renderer knows how to fill, found by name when the program is linked
+typedef enum {
+	modelMatrixUniform,
+	viewMatrixUniform,
+	projectionMatrixUniform,
+	lightPositionUniform,
+	eyePositionUniform,
+	meshOffsetsUniform,
+	materialIndexUniform,
+	uniformSlotCount
+} uniformSlot_t;
+
+// vertex inputs the renderer knows how to link to the entity buffers
+typedef enum {
+	vertexLayout,
+	uvLayout,
+	colorLayout,
+	normalLayout,
+	layoutSlotCount
+} layoutSlot_t;
+
+// struct for saving the informations about the active uniforms of a program
+typedef struct {
+	int id;
+	unsigned int type;
+	std::string name;
+} uniform_t;
+
+// program handed to the driver and not checked yet, with the sources it's cached with. The shaders are 0 for a
+// program restored from the cache
+typedef struct {
+	unsigned int program;
+	unsigned int vertex;
+	unsigned int fragment;
+	std::string sources;
+} pendingProgram_t;
+
+// class for loading, storing and dealing with shaders
+class Shader {
+	public:
+		// constructor method
+		Shader(char*);
+		// constructor method for a variant, the defines are added to the sources right after the version
+		Shader(char*, std::string);
+		// public method for loading vertex and fragment shaders
+		void loadShader(char*, char*);
+		// public method for loading a vertex shader file and fragment shader code generated at runtime
+		void loadShader(char*, std::string);
+		// public method for loading a compute shader (needs openGL 4.3)
+		void loadComputeShader(char*);
+		// public method for submitting vertex and fragment shaders without waiting for them to compile
+		void submitShader(char*, char*);
+		// method for finishing a submitted program once the driver is done with it, returns if the program is ready
+		bool poll();
+		// checks if the program is done (loaded, or submitted and polled after it was done)
+		bool isReady();
+		// checks if the program that's done failed to compile or link, it's drawn with a fallback until a reload works
+		bool hasFailed();
+		// method for compiling the program again from its files, without waiting for it
+		bool reload();
+		// method for finishing a reload once the driver is done: 1 if the new program replaced the old one, -1 if it
+		// failed and the old one is kept, 0 while it's still compiling
+		int pollReload();
+		bool isReloading();
+		// get methods for getting the files the shader is loaded from (NULL for generated code)
+		char* getVertexPath();
+		char* getFragmentPath();
+		// get method for getting the compile and link errors of the last program that was checked
+		std::string getLog();
+
+		// checks for KHR_parallel_shader_compile, which lets poll ask if a program is done without waiting for it
+		static bool hasParallelCompile();
+
+		// get method for getting the shader id
+		unsigned int getID();
+		// get method for getting the id of the vertex pulling version of the shader, submitted the first time it's asked
+		// for and 0 until it's done, or if it failed
+		unsigned int getPullingID();
+		// get method for getting the shader name
+		char* getName();
+		// get method for getting the buffer containing all the active uniforms of the shader
+		std::vector<uniform_t> getUniformBuffer();
+		// get method for getting the location of every uniform slot, -1 for the ones the shader doesn't use
+		const int* getUniformSlots();
+		// same as getUniformSlots for the vertex pulling version, which also has the meshOffsets uniform
+		const int* getPullingUniformSlots();
+		// get method for getting the attribute location of every layout slot, -1 for the ones the shader doesn't use
+		const int* getLayoutSlots();
+		// checks if the shader uses a uniform slot
+		bool hasUniform(uniformSlot_t);
+		// get method for checking if surfaces drawn with this shader receive screen space reflections
+		bool getScreenSpaceReflection();
+		// get method for getting how much of the screen space reflection is blended on the surface
+		float getReflectivity();
+
+		// set method for enabling screen space reflections on surfaces drawn with this shader
+		void setScreenSpaceReflection(bool);
+		// set method for setting how much of the screen space reflection is blended on the surface
+		void setReflectivity(float);
+		
+	private:
+		// shader name
+		char* name;
+		// defines the sources are compiled with (empty for shaders that aren't variants)
+		std::string defines;
+		// shader id
+		unsigned int id;
+		// buffer containing the shader uniforms information, and the locations of the ones in a slot
+		std::vector<uniform_t> uniformBuffer;
+		int uniformSlots[uniformSlotCount];
+		// vertex pulling version of the program and the locations of its uniforms
+		unsigned int pullingID;
+		int pullingUniformSlots[uniformSlotCount];
+		pendingProgram_t pendingPulling;
+		bool pullingFailed;
+		// sources the vertex pulling version is built from (the fragment code is only kept when it's generated)
+		char* vertexPath;
+		char* fragmentPath;
+		std::string fragmentCode;
+		// attribute locations of the shader layouts
+		int layoutSlots[layoutSlotCount];
+		// screen space reflection settings of the surfaces drawn with this shader
+		bool screenSpaceReflection;
+		float reflectivity;
+		// the program was checked after linking and its uniforms were found
+		bool ready;
+		bool failed;
+		// submitted program not finished yet, kept apart from the reload so compiling one doesn't lose the other
+		pendingProgram_t pending;
+		// program being compiled to replace this one after its files changed
+		unsigned int reloadID;
+		pendingProgram_t pendingReload;
+		// compile and link errors of the last program that was checked
+		std::string log;
+		
+		// method for compiling shader code
+		unsigned int compileShader(char*, char*);
+		// method for compiling and linking the code of the vertex and fragment shaders (the names are only for the log)
+		unsigned int compileShaderCode(char*, std::string, char*, std::string);
+		// same as compileShaderCode, split in submitting the work to the driver and checking the results
+		pendingProgram_t submitShaderCode(char*, std::string, char*, std::string);
+		bool finishShaderCode(pendingProgram_t*);
+		// method for compiling and linking a compute shader
+		unsigned int compileComputeShader(char*);
+		// method for reading the code of a shader file
+		std::string readShaderFile(char*);
+		// method for adding the defines of the variant to shader code
+		std::string specialize(std::string);
+		// method for rewriting a vertex shader to fetch its layouts from the mesh buffer instead of attributes
+		std::string createPullingVertexCode(std::string);
+		// method for asking the linked program for its active uniforms and inputs, and keeping the locations of the
+		// ones the renderer fills (program, uniforms, uniform slots, layout slots or NULL when they aren't needed)
+		static void reflectProgram(unsigned int, std::vector<uniform_t>*, int*, int*);
+};
+
+#endif
@@ -0,0 +1,255 @@
+#include "shaderCache.h"
+#include <glad\glad.h>
+#include <stdio.h>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+// constructor method
+ShaderCache::ShaderCache() {
+	this->initialized = false;
+	this->available = false;
+	this->hits = 0;
+	this->misses = 0;
+	this->reported = false;
+	this->setupStart = -1.0;
+	this->setupEnd = -1.0;
+	this->setupTime = 0.0;
+	this->runtimePrograms = 0;
+	this->runtimeTime = 0.0;
+	this->coldSetupTime = 0.0;
+}
+
+void ShaderCache::initialize() {
+	this->initialized = true;
+
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	this->available = formats > 0;
+
+	if (!this->available) {
+		printf("shader cache: no program binary formats, every shader is compiled\n");
+		return;
+	}
+
+	const char* vendor = (const char*)glGetString(GL_VENDOR);
+	const char* renderer = (const char*)glGetString(GL_RENDERER);
+	const char* version = (const char*)glGetString(GL_VERSION);
+
+	this->driver = std::string(vendor ? vendor : "") + "|" + (renderer ? renderer : "") + "|" + (version ? version : "");
+
+#ifdef _WIN32
+	_mkdir(SHADER_CACHE_DIRECTORY);
+#else
+	mkdir(SHADER_CACHE_DIRECTORY, 0755);
+#endif
+}
+
+// the programs created after the report are hot reloads and lazily compiled variants, they're counted apart so the
+// startup numbers stay those of the launch
+unsigned int ShaderCache::loadProgram(std::string sources) {
+	unsigned int program = this->restoreProgram(sources);
+
+	if (this->reported) {
+		this->runtimePrograms++;
+	}
+	else if (program != 0) {
+		this->hits++;
+	}
+	else {
+		this->misses++;
+	}
+
+	return(program);
+}
+
+// a binary that can't be read or that the driver doesn't accept gets replaced once the program is compiled again
+unsigned int ShaderCache::restoreProgram(std::string sources) {
+	if (!this->initialized) {
+		this->initialize();
+	}
+
+	if (!this->available) {
+		return(0);
+	}
+
+	std::ifstream stream(this->getPath(sources), std::ios::in | std::ios::binary);
+
+	if (!stream.is_open()) {
+		return(0);
+	}
+
+	// the driver is stored too, so a hash collision between drivers can't restore a binary from another one
+	GLenum format = 0;
+	unsigned int driverLength = 0;
+	unsigned int length = 0;
+
+	stream.read((char*)&format, sizeof(format));
+	stream.read((char*)&driverLength, sizeof(driverLength));
+
+	std::string driver(stream.good() ? driverLength : 0, '\0');
+
+	if (!driver.empty()) {
+		stream.read(&driver[0], driverLength);
+	}
+
+	stream.read((char*)&length, sizeof(length));
+
+	if (!stream.good() || driver != this->driver || length == 0) {
+		return(0);
+	}
+
+	std::vector<char> binary(length);
+	stream.read(&binary[0], length);
+
+	if (!stream.good()) {
+		return(0);
+	}
+
+	GLuint program = glCreateProgram();
+	glProgramBinary(program, format, &binary[0], length);
+
+	GLint result = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &result);
+
+	if (result != GL_TRUE) {
+		glDeleteProgram(program);
+		return(0);
+	}
+
+	return(program);
+}
+
+void ShaderCache::saveProgram(std::string sources, unsigned int program) {
+	if (!this->available) {
+		return;
+	}
+
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+	if (length <= 0) {
+		return;
+	}
+
+	std::vector<char> binary(length);
+	GLenum format = 0;
+	glGetProgramBinary(program, length, NULL, &format, &binary[0]);
+
+	std::ofstream stream(this->getPath(sources), std::ios::out | std::ios::binary | std::ios::trunc);
+
+	if (!stream.is_open()) {
+		printf("shader cache: impossible to write in %s\n", SHADER_CACHE_DIRECTORY);
+		return;
+	}
+
+	unsigned int driverLength = this->driver.size();
+	unsigned int binaryLength = length;
+
+	stream.write((char*)&format, sizeof(format));
+	stream.write((char*)&driverLength, sizeof(driverLength));
+	stream.write(this->driver.c_str(), driverLength);
+	stream.write((char*)&binaryLength, sizeof(binaryLength));
+	stream.write(&binary[0], binaryLength);
+}
+
+// the programs are compiled in parallel, so the setup time is the wall clock time from the first submit to the last
+// completion rather than the sum of the time spent in each call
+void ShaderCache::addSetupTime(double start, double end) {
+	if (this->reported) {
+		this->runtimeTime += end - start;
+		return;
+	}
+
+	if (this->setupStart < 0.0 || start < this->setupStart) {
+		this->setupStart = start;
+	}
+
+	this->setupEnd = std::max(this->setupEnd, end);
+	this->setupTime = this->setupEnd - this->setupStart;
+}
+
+// a launch is cold when at least one program had to be compiled, its time is kept on disk so that warm launches can
+// be compared to it
+void ShaderCache::report() {
+	this->reported = true;
+
+	std::string path = std::string(SHADER_CACHE_DIRECTORY) + "setup.txt";
+
+	if (this->misses > 0) {
+		this->coldSetupTime = this->setupTime;
+
+		std::ofstream stream(path, std::ios::out | std::ios::trunc);
+
+		if (stream.is_open()) {
+			stream << this->setupTime;
+		}
+
+		printf("shader setup: %.1f ms cold (%d compiled, %d cached)\n", this->setupTime * 1000.0, this->misses, this->hits);
+	}
+	else {
+		std::ifstream stream(path, std::ios::in);
+
+		if (stream.is_open()) {
+			stream >> this->coldSetupTime;
+		}
+
+		printf("shader setup: %.1f ms warm (%d cached), last cold launch %.1f ms\n", this->setupTime * 1000.0, this->hits, this->coldSetupTime * 1000.0);
+	}
+}
+
+bool ShaderCache::isReported() {
+	return(this->reported);
+}
+
+bool ShaderCache::isAvailable() {
+	return(this->available);
+}
+
+int ShaderCache::getHits() {
+	return(this->hits);
+}
+
+int ShaderCache::getMisses() {
+	return(this->misses);
+}
+
+double ShaderCache::getSetupTime() {
+	return(this->setupTime);
+}
+
+double ShaderCache::getColdSetupTime() {
+	return(this->coldSetupTime);
+}
+
+int ShaderCache::getRuntimePrograms() {
+	return(this->runtimePrograms);
+}
+
+double ShaderCache::getRuntimeTime() {
+	return(this->runtimeTime);
+}
+
+std::string ShaderCache::getPath(std::string sources) {
+	char name[32];
+	snprintf(name, sizeof(name), "%016llx.bin", hash(sources + this->driver));
+
+	return(std::string(SHADER_CACHE_DIRECTORY) + name);
+}
+
+unsigned long long ShaderCache::hash(std::string data) {
+	unsigned long long value = 14695981039346656037ULL;
+
+	for (int i = 0; i < data.size(); i++) {
+		value ^= (unsigned char)data[i];
+		value *= 1099511628211ULL;
+	}
+
+	return(value);
+}
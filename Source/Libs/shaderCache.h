@@ -0,0 +1,63 @@
+#ifndef __SHADERCACHE__
+#define __SHADERCACHE__
+
+#include <string>
+
+// directory the program binaries are stored in, next to the shader sources
+#define SHADER_CACHE_DIRECTORY "../ShaderCache/"
+
+// class storing the linked shader programs on disk with glGetProgramBinary and restoring them with glProgramBinary on
+// later launches, so that only new or changed shaders are compiled. Programs are keyed by a hash of their sources and
+// of the driver (vendor, renderer and version), since a binary is only valid for the driver that produced it
+class ShaderCache {
+	public:
+		// constructor method, doesn't touch openGL so it can run before the context exists
+		ShaderCache();
+
+		// method for restoring the program of the given sources, returns 0 if it isn't cached or the driver rejects it
+		unsigned int loadProgram(std::string);
+		// method for storing a linked program (sources, program), needs the retrievable hint set before linking
+		void saveProgram(std::string, unsigned int);
+		// method for adding the time (s) spent creating a program, cached or not (start, end), after the report it goes to
+		// the runtime time
+		void addSetupTime(double, double);
+		// method for printing the shader setup time of this launch, and the one of the last cold launch when this one is warm,
+		// once every startup program is done
+		void report();
+		bool isReported();
+
+		bool isAvailable();
+		int getHits();
+		int getMisses();
+		double getSetupTime();
+		// setup time of the last launch that compiled shaders, 0 if there's none on record
+		double getColdSetupTime();
+		// programs created after the report (hot reloads, lazily compiled variants) and the CPU time (s) spent on them
+		int getRuntimePrograms();
+		double getRuntimeTime();
+
+	private:
+		bool initialized;
+		bool available;
+		std::string driver;
+		int hits;
+		int misses;
+		bool reported;
+		double setupStart;
+		double setupEnd;
+		double setupTime;
+		double coldSetupTime;
+		int runtimePrograms;
+		double runtimeTime;
+
+		// method for reading the driver strings and checking for binary formats, the first time the cache is used
+		void initialize();
+		// method for restoring the program of the given sources without counting it, 0 if it can't be
+		unsigned int restoreProgram(std::string);
+		// method for getting the file of the program of the given sources
+		std::string getPath(std::string);
+		// 64 bit FNV-1a hash
+		static unsigned long long hash(std::string);
+};
+
+#endif
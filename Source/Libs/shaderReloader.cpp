@@ -0,0 +1,197 @@
+#include "shaderReloader.h"
+#include "init.h"
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#endif
+
+// constructor method
+ShaderReloader::ShaderReloader() {
+	this->running = true;
+	this->watcher = std::thread(&ShaderReloader::watchFiles, this);
+}
+
+ShaderReloader::~ShaderReloader() {
+	this->running = false;
+
+	if (this->watcher.joinable()) {
+		this->watcher.join();
+	}
+}
+
+void ShaderReloader::watch(Shader* shader) {
+	if (shader->getVertexPath() == NULL) {
+		return;
+	}
+
+	this->shaders.push_back(shader);
+
+	std::lock_guard<std::mutex> lock(this->filesMutex);
+
+	char* paths[2] = { shader->getVertexPath(), shader->getFragmentPath() };
+
+	for (int i = 0; i < 2; i++) {
+		if (paths[i] != NULL && this->files.find(paths[i]) == this->files.end()) {
+			this->files[paths[i]] = getFileStamp(paths[i]);
+		}
+	}
+}
+
+// the render thread only takes the list of changed files from the watcher, the file system is never touched here
+// except to read the sources of the shaders that changed
+void ShaderReloader::update() {
+	std::vector<std::string> changed;
+
+	{
+		std::lock_guard<std::mutex> lock(this->filesMutex);
+		changed.swap(this->changedFiles);
+	}
+
+	for (int i = 0; i < this->shaders.size() && !changed.empty(); i++) {
+		Shader* shader = this->shaders[i];
+		bool vertexChanged = std::find(changed.begin(), changed.end(), shader->getVertexPath()) != changed.end();
+		bool fragmentChanged = shader->getFragmentPath() != NULL && std::find(changed.begin(), changed.end(), shader->getFragmentPath()) != changed.end();
+
+		if ((vertexChanged || fragmentChanged) && std::find(this->dirty.begin(), this->dirty.end(), shader) == this->dirty.end()) {
+			this->dirty.push_back(shader);
+		}
+	}
+
+	for (int i = 0; i < this->dirty.size(); i++) {
+		Shader* shader = this->dirty[i];
+
+		// a change during a reload, or before the first compilation finished, is submitted once it's done
+		if (shader->isReloading() || !shader->isReady()) {
+			continue;
+		}
+
+		this->dirty.erase(this->dirty.begin() + i);
+		i--;
+
+		printf("reloading %s\n", shader->getName());
+
+		if (shader->reload()) {
+			this->reloading.push_back(shader);
+		}
+		else {
+			this->addReload(shader, false);
+		}
+	}
+
+	for (int i = 0; i < this->reloading.size(); i++) {
+		int result = this->reloading[i]->pollReload();
+
+		if (result != 0) {
+			this->addReload(this->reloading[i], result > 0);
+			this->reloading.erase(this->reloading.begin() + i);
+			i--;
+		}
+	}
+}
+
+int ShaderReloader::getWatchedCount() {
+	return(this->shaders.size());
+}
+
+int ShaderReloader::getReloadingCount() {
+	return(this->reloading.size());
+}
+
+std::vector<shaderReload_t> ShaderReloader::getReloads() {
+	return(this->reloads);
+}
+
+void ShaderReloader::watchFiles() {
+	profiler->setThreadName("shader watcher");
+
+	while (this->running) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(SHADER_WATCH_INTERVAL));
+
+		PROFILE_ZONE("ShaderReloader::watchFiles");
+
+		std::map<std::string, fileStamp_t> files;
+
+		{
+			std::lock_guard<std::mutex> lock(this->filesMutex);
+			files = this->files;
+		}
+
+		// the files are checked without holding the lock, so the render thread never waits for the file system
+		std::vector<std::string> changed;
+
+		for (std::map<std::string, fileStamp_t>::iterator it = files.begin(); it != files.end(); it++) {
+			fileStamp_t stamp = getFileStamp(it->first);
+
+			// editors can delete the file before writing it again, it's checked again on the next round
+			if (stamp.time >= 0 && (stamp.time != it->second.time || stamp.size != it->second.size)) {
+				it->second = stamp;
+				changed.push_back(it->first);
+			}
+		}
+
+		if (!changed.empty()) {
+			std::lock_guard<std::mutex> lock(this->filesMutex);
+
+			for (int i = 0; i < changed.size(); i++) {
+				this->files[changed[i]] = files[changed[i]];
+				this->changedFiles.push_back(changed[i]);
+			}
+		}
+	}
+}
+
+// st_mtime and _stat64 only have seconds, the platform calls give the full precision of the file system
+fileStamp_t ShaderReloader::getFileStamp(std::string path) {
+	fileStamp_t stamp;
+	stamp.time = -1;
+	stamp.size = 0;
+
+#ifdef _WIN32
+	WIN32_FILE_ATTRIBUTE_DATA info;
+
+	if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &info)) {
+		return(stamp);
+	}
+
+	// intervals of 100ns, in nanoseconds the time since 1601 wouldn't fit
+	stamp.time = ((long long)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime;
+	stamp.size = ((long long)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+#else
+	struct stat info;
+
+	if (stat(path.c_str(), &info) != 0) {
+		return(stamp);
+	}
+
+#ifdef __APPLE__
+	stamp.time = (long long)info.st_mtimespec.tv_sec * 1000000000LL + info.st_mtimespec.tv_nsec;
+#else
+	stamp.time = (long long)info.st_mtim.tv_sec * 1000000000LL + info.st_mtim.tv_nsec;
+#endif
+	stamp.size = (long long)info.st_size;
+#endif
+
+	return(stamp);
+}
+
+void ShaderReloader::addReload(Shader* shader, bool success) {
+	shaderReload_t reload;
+	reload.name = shader->getName();
+	reload.success = success;
+	reload.log = shader->getLog();
+
+	printf("%s %s\n", shader->getName(), success ? "reloaded" : "failed to reload, keeping the old program");
+
+	this->reloads.insert(this->reloads.begin(), reload);
+
+	if (this->reloads.size() > SHADER_RELOAD_HISTORY) {
+		this->reloads.pop_back();
+	}
+}
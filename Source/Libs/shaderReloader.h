@@ -0,0 +1,75 @@
+#ifndef __SHADERRELOADER__
+#define __SHADERRELOADER__
+
+#include <map>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include "shader.h"
+
+// milliseconds between two checks of the shader files
+#define SHADER_WATCH_INTERVAL 250
+// reloads kept for the ui
+#define SHADER_RELOAD_HISTORY 8
+
+// result of reloading a shader, for the ui
+typedef struct {
+	std::string name;
+	bool success;
+	std::string log;
+} shaderReload_t;
+
+// what a file is compared with on the next check: the modification time alone misses saves close to each other on
+// file systems with coarse times, the size catches most of those
+typedef struct {
+	// modification time in the finest unit of the platform, only compared with itself, -1 if the file can't be read
+	long long time;
+	long long size;
+} fileStamp_t;
+
+// class watching the files of the shaders and recompiling the shaders that use a file that changed: a worker thread
+// compares the modification times of the files, and the render thread submits the new programs and swaps them in once
+// they linked (keeping the old ones when they don't), without waiting for the driver when it can compile in parallel
+class ShaderReloader {
+	public:
+		// constructor method, starts the watcher thread
+		ShaderReloader();
+		// destructor method, stops the watcher thread
+		~ShaderReloader();
+
+		// method for adding a shader to the watched ones, its files are watched from now on
+		void watch(Shader*);
+		// method for submitting the shaders whose files changed and swapping the ones that finished, once per frame
+		void update();
+
+		int getWatchedCount();
+		int getReloadingCount();
+		// last reloads, the most recent first
+		std::vector<shaderReload_t> getReloads();
+
+	private:
+		std::vector<Shader*> shaders;
+		std::vector<Shader*> reloading;
+		// shaders whose files changed and that weren't submitted yet, they wait for their reload or first compile
+		std::vector<Shader*> dirty;
+		std::vector<shaderReload_t> reloads;
+
+		// stamp of every watched file, and the files that changed since the last update (shared with the watcher thread)
+		std::map<std::string, fileStamp_t> files;
+		std::vector<std::string> changedFiles;
+		std::mutex filesMutex;
+
+		std::thread watcher;
+		std::atomic<bool> running;
+
+		// method run by the watcher thread
+		void watchFiles();
+		// modification time and size of a file, with the finest time the platform gives
+		static fileStamp_t getFileStamp(std::string);
+		// method for keeping the result of a reload for the ui
+		void addReload(Shader*, bool);
+};
+
+#endif
@@ -0,0 +1,99 @@
+#include "shaderVariants.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+// constructor method
+ShaderVariants::ShaderVariants(char* name, char* vertexPath, char* fragmentPath) {
+	this->name = name;
+	this->vertexPath = vertexPath;
+	this->fragmentPath = fragmentPath;
+
+	this->readFeatures(vertexPath);
+	this->readFeatures(fragmentPath);
+}
+
+// the map keeps the features sorted, so the same combination always gets the same key
+Shader* ShaderVariants::getVariant(std::map<std::string, int> values) {
+	std::string key;
+
+	for (std::map<std::string, int>::iterator it = values.begin(); it != values.end(); it++) {
+		key += (key.empty() ? "" : " ") + it->first + "=" + std::to_string(it->second);
+	}
+
+	std::map<std::string, Shader*>::iterator cached = this->variants.find(key);
+
+	if (cached != this->variants.end()) {
+		return(cached->second);
+	}
+
+	for (std::map<std::string, int>::iterator it = values.begin(); it != values.end(); it++) {
+		if (std::find(this->features.begin(), this->features.end(), it->first) == this->features.end()) {
+			printf("%s doesn't declare the feature %s\n", this->name, it->first.c_str());
+		}
+	}
+
+	// the shader keeps a pointer to its name
+	std::string variantName = std::string(this->name) + " (" + key + ")";
+	char* shaderName = (char*)calloc(variantName.size() + 1, sizeof(char));
+	strcpy(shaderName, variantName.c_str());
+
+	Shader* shader = new Shader(shaderName, getDefines(values));
+	shader->loadShader(this->vertexPath, this->fragmentPath);
+
+	this->variants[key] = shader;
+
+	return(shader);
+}
+
+Shader* ShaderVariants::getVariant(std::string feature, int value) {
+	std::map<std::string, int> values;
+	values[feature] = value;
+
+	return(this->getVariant(values));
+}
+
+std::vector<std::string> ShaderVariants::getFeatures() {
+	return(this->features);
+}
+
+int ShaderVariants::getVariantCount() {
+	return(this->variants.size());
+}
+
+std::string ShaderVariants::getDefines(std::map<std::string, int> values) {
+	std::string defines;
+
+	for (std::map<std::string, int>::iterator it = values.begin(); it != values.end(); it++) {
+		if (it->second != 0) {
+			defines += "#define " + it->first + " " + std::to_string(it->second) + "\n";
+		}
+	}
+
+	return(defines);
+}
+
+void ShaderVariants::readFeatures(char* path) {
+	std::ifstream stream(path, std::ios::in);
+	std::string line;
+
+	while (std::getline(stream, line)) {
+		std::istringstream tokens(line);
+		std::string pragma;
+		std::string directive;
+		std::string feature;
+
+		if (!(tokens >> pragma >> directive) || pragma != "#pragma" || directive != "features") {
+			continue;
+		}
+
+		while (tokens >> feature) {
+			if (std::find(this->features.begin(), this->features.end(), feature) == this->features.end()) {
+				this->features.push_back(feature);
+			}
+		}
+	}
+}
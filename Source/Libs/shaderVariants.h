@@ -0,0 +1,40 @@
+#ifndef __SHADERVARIANTS__
+#define __SHADERVARIANTS__
+
+#include <map>
+#include <string>
+#include <vector>
+#include "shader.h"
+
+// class compiling specialized versions of a vertex and fragment shader pair: the sources declare the features they can
+// be specialized on with a "#pragma features" line, and every combination of feature values asked for is compiled once
+// with the matching defines and kept, so the shaders don't need runtime branches or loops over uniform counts
+class ShaderVariants {
+	public:
+		// constructor method (name, vertex shader path, fragment shader path), reads the features of the sources
+		ShaderVariants(char*, char*, char*);
+
+		// shader compiled with the given feature values, compiled the first time it's asked for (0 leaves a feature
+		// undefined, so it can be tested with #ifdef)
+		Shader* getVariant(std::map<std::string, int>);
+		// same as getVariant for a single feature
+		Shader* getVariant(std::string, int);
+
+		std::vector<std::string> getFeatures();
+		int getVariantCount();
+
+		// defines of a combination of feature values, for shaders that are specialized without a cache
+		static std::string getDefines(std::map<std::string, int>);
+
+	private:
+		char* name;
+		char* vertexPath;
+		char* fragmentPath;
+		std::vector<std::string> features;
+		std::map<std::string, Shader*> variants;
+
+		// method for reading the features declared in a shader file
+		void readFeatures(char*);
+};
+
+#endif
@@ -1,611 +1,1239 @@
-#include "ui.h"
-#include "init.h"
-#include "entity.h"
-#include <stdlib.h>
-#include <vector>
-#include <string>
-#include <math.h>
-#include <sstream>
-#include <iomanip>
-#include "imgui.h"
-#include "imgui_impl_glfw.h"
-#include "imgui_impl_opengl3.h"
-#include "renderer.h"
-#include "eventHandler.h"
-#include "GLFW/glfw3.h"
-#include <SFML/Graphics.hpp>
-#include <stdio.h>
-#include <algorithm>
-
-// initialize the fields and formats the texts styles
-UI::UI(GLFWwindow *window, Renderer* renderer, EventHandler* eventHandler) {
-	// get the window reference
-	this->window = window;
-	this->renderer = renderer;
-	this->eventHandler = eventHandler;
-
-	// setup the update clock
-	this->tick = sf::milliseconds(1000 / 10);
-	this->time = this->clock.getElapsedTime();
-
-	this->showMetricsWindow = false;
-	this->showUserGuide = false;
-	this->showAboutWindow = false;
-	this->showDemoWindow = false;
-	this->showFPS = true;
-	this->pauseFlag = false;
-	this->showLeftColumn = true;
-	this->showRightColumn = true;
-	this->showBottomRow = true;
-
-	//ImGui::SFML::Init(*this->window);
-	ImGui::CreateContext();
-	ImGui_ImplGlfw_InitForOpenGL(window, true);
-	ImGui_ImplOpenGL3_Init();
-	ImGuiIO& io = ImGui::GetIO();
-
-	io.FontDefault = io.Fonts->AddFontFromFileTTF("../Fonts/OpenSans/OpenSans-Regular.ttf", 18.0f);
-
-	this->setupImGuiStyle();
-}
-
-void UI::setReferenceWindow(GLFWwindow *window) {
-	this->window = window;
-}
-
-void UI::setupImGuiStyle() {
-	ImGuiStyle& style = ImGui::GetStyle();
-	style.FrameRounding = 0.0f;
-	ImVec4* colors = ImGui::GetStyle().Colors;
-	colors[ImGuiCol_Text] = ImVec4(1.00f, 1.00f, 1.00f, 1.00f);
-	colors[ImGuiCol_TextDisabled] = ImVec4(0.50f, 0.50f, 0.50f, 1.00f);
-	colors[ImGuiCol_WindowBg] = ImVec4(0.08f, 0.08f, 0.08f, 0.94f);
-	colors[ImGuiCol_ChildBg] = ImVec4(0.00f, 0.00f, 0.00f, 0.00f);
-	colors[ImGuiCol_PopupBg] = ImVec4(0.08f, 0.08f, 0.08f, 0.94f);
-	colors[ImGuiCol_Border] = ImVec4(0.43f, 0.43f, 0.50f, 0.50f);
-	colors[ImGuiCol_BorderShadow] = ImVec4(0.00f, 0.00f, 0.00f, 0.00f);
-	colors[ImGuiCol_FrameBg] = ImVec4(0.18f, 0.18f, 0.18f, 0.94f);
-	colors[ImGuiCol_FrameBgHovered] = ImVec4(0.00f, 0.45f, 1.00f, 1.00f);
-	colors[ImGuiCol_FrameBgActive] = ImVec4(0.18f, 0.61f, 1.00f, 1.00f);
-	colors[ImGuiCol_TitleBg] = ImVec4(0.18f, 0.18f, 0.18f, 1.00f);
-	colors[ImGuiCol_TitleBgActive] = ImVec4(0.00f, 0.52f, 1.00f, 1.00f);
-	colors[ImGuiCol_TitleBgCollapsed] = ImVec4(0.00f, 0.00f, 0.00f, 0.51f);
-	colors[ImGuiCol_MenuBarBg] = ImVec4(0.17f, 0.17f, 0.17f, 0.48f);
-	colors[ImGuiCol_ScrollbarBg] = ImVec4(0.02f, 0.02f, 0.02f, 0.53f);
-	colors[ImGuiCol_ScrollbarGrab] = ImVec4(0.31f, 0.31f, 0.31f, 1.00f);
-	colors[ImGuiCol_ScrollbarGrabHovered] = ImVec4(0.41f, 0.41f, 0.41f, 1.00f);
-	colors[ImGuiCol_ScrollbarGrabActive] = ImVec4(0.51f, 0.51f, 0.51f, 1.00f);
-	colors[ImGuiCol_CheckMark] = ImVec4(0.00f, 0.62f, 1.00f, 1.00f);
-	colors[ImGuiCol_SliderGrab] = ImVec4(0.61f, 0.61f, 0.61f, 1.00f);
-	colors[ImGuiCol_SliderGrabActive] = ImVec4(0.82f, 0.82f, 0.82f, 1.00f);
-	colors[ImGuiCol_Button] = ImVec4(0.00f, 0.45f, 1.00f, 1.00f);
-	colors[ImGuiCol_ButtonHovered] = ImVec4(0.21f, 0.57f, 1.00f, 1.00f);
-	colors[ImGuiCol_ButtonActive] = ImVec4(0.34f, 0.64f, 1.00f, 1.00f);
-	colors[ImGuiCol_Header] = ImVec4(0.18f, 0.18f, 0.18f, 0.94f);
-	colors[ImGuiCol_HeaderHovered] = ImVec4(0.00f, 0.45f, 1.00f, 1.00f);
-	colors[ImGuiCol_HeaderActive] = ImVec4(0.18f, 0.61f, 1.00f, 1.00f);
-	colors[ImGuiCol_Separator] = ImVec4(0.43f, 0.43f, 0.50f, 0.50f);
-	colors[ImGuiCol_SeparatorHovered] = ImVec4(0.00f, 1.00f, 0.18f, 0.78f);
-	colors[ImGuiCol_SeparatorActive] = ImVec4(0.10f, 0.40f, 0.75f, 1.00f);
-	colors[ImGuiCol_ResizeGrip] = ImVec4(0.00f, 0.00f, 0.00f, 0.00f);
-	colors[ImGuiCol_ResizeGripHovered] = ImVec4(0.26f, 0.59f, 0.98f, 0.00f);
-	colors[ImGuiCol_ResizeGripActive] = ImVec4(0.26f, 0.59f, 0.98f, 0.00f);
-	colors[ImGuiCol_Tab] = ImVec4(0.18f, 0.18f, 0.18f, 0.94f);
-	colors[ImGuiCol_TabHovered] = ImVec4(0.18f, 0.61f, 1.00f, 1.00f);
-	colors[ImGuiCol_TabActive] = ImVec4(0.00f, 0.45f, 1.00f, 1.00f);
-	colors[ImGuiCol_TabUnfocused] = ImVec4(0.07f, 0.10f, 0.15f, 0.97f);
-	colors[ImGuiCol_TabUnfocusedActive] = ImVec4(0.14f, 0.26f, 0.42f, 1.00f);
-	colors[ImGuiCol_PlotLines] = ImVec4(0.00f, 0.65f, 1.00f, 1.00f);
-	colors[ImGuiCol_PlotLinesHovered] = ImVec4(1.00f, 0.43f, 0.35f, 1.00f);
-	colors[ImGuiCol_PlotHistogram] = ImVec4(0.90f, 0.70f, 0.00f, 1.00f);
-	colors[ImGuiCol_PlotHistogramHovered] = ImVec4(1.00f, 0.60f, 0.00f, 1.00f);
-	colors[ImGuiCol_TextSelectedBg] = ImVec4(0.00f, 0.46f, 1.00f, 0.35f);
-	colors[ImGuiCol_DragDropTarget] = ImVec4(1.00f, 1.00f, 0.00f, 0.90f);
-	colors[ImGuiCol_NavHighlight] = ImVec4(0.26f, 0.59f, 0.98f, 1.00f);
-	colors[ImGuiCol_NavWindowingHighlight] = ImVec4(1.00f, 1.00f, 1.00f, 0.70f);
-	colors[ImGuiCol_NavWindowingDimBg] = ImVec4(0.80f, 0.80f, 0.80f, 0.20f);
-	colors[ImGuiCol_ModalWindowDimBg] = ImVec4(0.80f, 0.80f, 0.80f, 0.35f);
-}
-
-void UI::drawLeftColumn() {
-	static bool firstDraw = true;
-	static Entity *selectedEntity;
-	static int selected = -1;
-
-	static ImGuiWindowFlags leftColumnWindowFlags = ImGuiWindowFlags_NoMove |
-		//ImGuiWindowFlags_NoResize |
-		ImGuiWindowFlags_NoCollapse |
-		ImGuiWindowFlags_NoSavedSettings |
-		ImGuiWindowFlags_NoTitleBar;
-
-	ImGui::SetNextWindowSizeConstraints(ImVec2(0, -1), ImVec2(FLT_MAX, -1));
-
-	ImGui::Begin("Left Column", NULL, leftColumnWindowFlags);
-
-	if (ImGui::CollapsingHeader("Entities")) {
-		for (int i = 0; i < entityBuffer.size(); i++) {
-			if (ImGui::Selectable(entityBuffer[i]->getName().c_str(), selected == i)) {
-				if (selected == i) {
-					selected = -1;
-					selectedEntity = NULL;
-				}
-				else {
-					selectedEntity = entityBuffer[i];
-					selected = i;
-				}
-			}
-		}
-	}
-
-	ImGui::Separator();
-
-	if (selectedEntity != NULL) {
-		ImGui::Text(std::string("Entity: ").append(selectedEntity->getName()).c_str());
-		if (ImGui::CollapsingHeader("Properties")) {
-			
-			if (ImGui::TreeNode("Position")) {
-				float x = selectedEntity->getWorldPosition().x;
-				ImGui::DragFloat("X", &x, 0.005f);
-				float y = selectedEntity->getWorldPosition().y;
-				ImGui::DragFloat("Y", &y, 0.005f);
-				float z = selectedEntity->getWorldPosition().z;
-				ImGui::DragFloat("Z", &z, 0.005f);
-
-				selectedEntity->placeAt(glm::vec3(x, y, z), camera.getViewMatrix());
-
-				ImGui::TreePop();
-			}
-
-			if (ImGui::TreeNode("Rotation")) {
-				float x = selectedEntity->getRotationFactor().x;
-				ImGui::DragFloat("X", &x, 0.02f);
-				float y = selectedEntity->getRotationFactor().y;
-				ImGui::DragFloat("Y", &y, 0.02f);
-				float z = selectedEntity->getRotationFactor().z;
-				ImGui::DragFloat("Z", &z, 0.02f);
-
-				selectedEntity->setRotation(x, y, z);
-
-				ImGui::TreePop();
-			}
-
-			if (ImGui::TreeNode("Scale")) {
-				float x = selectedEntity->getScalingFactor().x;
-				if (ImGui::DragFloat("X", &x, 0.005f));
-				float y = selectedEntity->getScalingFactor().y;
-				if (ImGui::DragFloat("Y", &y, 0.005f));
-				float z = selectedEntity->getScalingFactor().z;
-				if (ImGui::DragFloat("Z", &z, 0.005f));
-
-				selectedEntity->setScale(glm::vec3(x, y, z));
-			}
-
-			ImGui::Separator();
-
-			std::vector<char*> shaderNames;
-
-			for (int i = 0; i < shaderBuffer.size(); i++) {
-				shaderNames.push_back(shaderBuffer[i].getName());
-			}
-
-			static int item_current;
-			char** Carray = shaderNames.data();
-
-			size_t arraySize = shaderNames.size();
-
-			item_current = selectedEntity->getShader();
-
-			ImGui::Text("Shader");
-			ImGui::SameLine();
-			ImGui::Combo("###ShaderDropdown", &item_current, Carray, arraySize);
-
-			selectedEntity->setShader(item_current);
-
-			std::vector<char*> outlineNames;
-
-			outlineNames.push_back((char*)"Solid");
-			outlineNames.push_back((char*)"Alpha");
-			outlineNames.push_back((char*)"Wireframe");
-
-			char** outlineCarray = outlineNames.data();
-
-			size_t outlineArraySize = outlineNames.size();
-
-			static int outlineCurrent = outlineType;
-
-			ImGui::Text("Outline");
-			ImGui::SameLine();
-			ImGui::Combo("###OutlineDropdown", &outlineCurrent, outlineCarray, outlineArraySize);
-
-			outlineType = outlineCurrent;
-		}
-	}
-
-	ImGui::PushStyleColor(ImGuiCol_ResizeGrip, 0);
-
-	if (firstDraw) {
-		ImGui::SetWindowSize(ImVec2(250, screenHeight - this->menuBarSize.y));
-		firstDraw = false;
-	}
-	
-	if (updateResolution) {
-		ImGui::SetWindowSize(ImVec2(ImGui::GetWindowWidth(), screenHeight - this->menuBarSize.y));
-	}
-
-	this->leftColumnSize = ImGui::GetWindowSize();
-
-	this->renderer->setHighlightedEntity(selected);
-	
-	ImGui::SetWindowPos(ImVec2(0, this->menuBarSize.y));
-
-	static ImGuiStyle& leftColumnStyle = ImGui::GetStyle();
-
-	leftColumnStyle.WindowRounding = 0;
-	leftColumnStyle.WindowBorderSize = 0;
-
-	ImGui::End();
-}
-
-void UI::drawRightColumn() {
-	static bool firstDraw = true;
-	static Entity* selectedEntity;
-
-	static ImGuiWindowFlags rightColumnWindowFlags = ImGuiWindowFlags_NoMove |
-		//ImGuiWindowFlags_NoResize |
-		ImGuiWindowFlags_NoCollapse |
-		ImGuiWindowFlags_NoSavedSettings |
-		ImGuiWindowFlags_NoTitleBar;
-
-	ImGui::SetNextWindowSizeConstraints(ImVec2(0, -1), ImVec2(FLT_MAX, -1));
-
-	ImGui::Begin("Right Column", NULL, rightColumnWindowFlags);
-	static bool antialiasing = true;
-	static int item_current = 4;
-	if (ImGui::CollapsingHeader("Rendering Options")) {
-		bool tmp = vsync;
-		
-		if (ImGui::MenuItem("Pause", NULL, &this->pauseFlag));
-		if (ImGui::MenuItem("Render Real Time Reflections", NULL, &doReflection));
-		if (ImGui::MenuItem("VSync", NULL, &vsync)) {
-			if (tmp != vsync) {
-				if (vsync == true) {
-					glfwSwapInterval(1);
-				}
-				else {
-					glfwSwapInterval(0);
-				}
-			}
-		}
-
-		tmp = fullscreen;
-		if (ImGui::MenuItem("Fullscreen", NULL, &fullscreen)) {
-			if (tmp != fullscreen) {
-				if (fullscreen == true) {
-					GLFWmonitor* monitor = glfwGetPrimaryMonitor();
-					const GLFWvidmode* mode = glfwGetVideoMode(monitor);
-					glfwSetWindowMonitor(this->window, monitor, 0, 0, mode->width, mode->height, mode->refreshRate);
-
-					int width;
-					int height;
-					glfwGetFramebufferSize(window, &width, &height);
-					glViewport(0, 0, mode->width, mode->height);
-					screenWidth = mode->width;
-					screenHeight = mode->height;
-					updateResolution = true;
-				}
-				else {
-					glfwSetWindowMonitor(this->window, NULL, 0, 0, windowWidth, windowHeight, 60);
-					glfwSetWindowPos(this->window, 40, 40);
-
-					int width;
-					int height;
-					glfwGetFramebufferSize(window, &width, &height);
-					glViewport(0, 0, width, height);
-					screenWidth = width;
-					screenHeight = height;
-					updateResolution = true;
-				}
-			}
-
-		}
-
-		if (ImGui::MenuItem("Depth Buffer", NULL, &depthBuffer));
-
-		const char* items[] = {"1", "2", "4", "8", "16"};
-		
-		ImGui::Text("MSAA");
-		ImGui::SameLine();
-		ImGui::Combo("###MSAADropdown", &item_current, items, IM_ARRAYSIZE(items));
-	}
-
-	samples = pow(2, item_current + 1);
-
-	if (ImGui::CollapsingHeader("Bounding Box Display")) {
-		if (ImGui::MenuItem("Object Bounding Box", NULL, &drawOBB));
-		if (ImGui::MenuItem("External Axis Aligned Bounding Box", NULL, &drawAABB1));
-		if (ImGui::MenuItem("Internal Axis Aligned Bounding Box", NULL, &drawAABB2));
-		if (ImGui::MenuItem("Average Axis Aligned Bounding Box", NULL, &drawAABB3));
-		if (ImGui::MenuItem("True Axis Aligned Bounding Box", NULL, &drawAABB4));
-		if (ImGui::MenuItem("Internal Bounding Sphere", NULL, &drawBS));
-		if (ImGui::MenuItem("External Bounding Sphere", NULL, &drawBS2));
-		if (ImGui::MenuItem("True Bounding Sphere", NULL, &drawBS3));
-	}
-
-	ImGui::PushStyleColor(ImGuiCol_ResizeGrip, 0);
-
-	if (firstDraw) {
-		ImGui::SetWindowSize(ImVec2(250, screenHeight - this->menuBarSize.y));
-		firstDraw = false;
-	}
-
-	if (updateResolution) {
-		ImGui::SetWindowSize(ImVec2(ImGui::GetWindowWidth(), screenHeight - this->menuBarSize.y));
-	}
-
-	ImGui::SetWindowPos(ImVec2(screenWidth - ImGui::GetWindowWidth(), this->menuBarSize.y));
-	this->rightColumnSize = ImGui::GetWindowSize();
-
-	static ImGuiStyle& rightColumnStyle = ImGui::GetStyle();
-
-	rightColumnStyle.WindowRounding = 0;
-	rightColumnStyle.WindowBorderSize = 0;
-
-	ImGui::End();
-}
-
-void UI::drawBottomRow() {
-	static bool firstDraw = true;
-
-	static ImGuiWindowFlags bottomRowFlags = ImGuiWindowFlags_NoMove |
-		//ImGuiWindowFlags_NoResize |
-		ImGuiWindowFlags_NoCollapse |
-		ImGuiWindowFlags_NoSavedSettings |
-		ImGuiWindowFlags_NoTitleBar;
-
-	ImGui::SetNextWindowSizeConstraints(ImVec2(-1, 0), ImVec2(-1, FLT_MAX));
-
-	ImGui::Begin("BottomRow", NULL, bottomRowFlags);
-	{
-		float height;
-		if (firstDraw) {
-			height = 200.0f;
-		}
-		else {
-			height = std::min(ImGui::GetWindowSize().y - 20.0f, 200.0f);
-		}
-
-		ImGui::BeginChild("OutlineMask", ImVec2((float)screenWidth / (float)screenHeight * height, 0));
-		ImGui::Image((ImTextureID)this->renderer->getOutlineMaskTexture(), ImVec2((float)screenWidth / (float)screenHeight * height, height), ImVec2(0, 1), ImVec2(1, 0));
-		ImGui::EndChild();
-
-		ImGui::SameLine();
-
-		ImGui::BeginChild("Depth", ImVec2((float)screenWidth / (float)screenHeight * height, 0));
-		ImGui::Image((ImTextureID)this->renderer->getDepthBufferTexture(), ImVec2((float)screenWidth / (float)screenHeight * height, height), ImVec2(0, 1), ImVec2(1, 0));
-		ImGui::EndChild();
-
-		ImGui::SameLine();
-
-		ImGui::BeginChild("Texture", ImVec2((float)screenWidth / (float)screenHeight * height, 0));
-		ImGui::Image((ImTextureID)entityBuffer[3]->getTexture(), ImVec2((float)screenWidth / (float)screenHeight * height, height), ImVec2(0, 1), ImVec2(1, 0));
-		ImGui::EndChild();
-	}
-
-	if (firstDraw) {
-		ImGui::SetWindowSize(ImVec2(screenWidth - 500, 220));
-		firstDraw = false;
-	}
-	else {
-		ImGui::SetWindowSize(ImVec2(screenWidth - this->leftColumnSize.x - this->rightColumnSize.x, ImGui::GetWindowSize().y));
-	}
-	
-	ImVec2 size = ImGui::GetWindowSize();
-
-	ImGui::SetWindowPos(ImVec2(this->leftColumnSize.x, screenHeight - size.y));
-
-	ImGui::End();
-}
-
-void UI::drawFPSWindow() {
-	static ImGuiWindowFlags FPSwindowFlags = ImGuiWindowFlags_NoMove |
-		ImGuiWindowFlags_NoResize |
-		ImGuiWindowFlags_NoCollapse |
-		ImGuiWindowFlags_NoSavedSettings |
-		ImGuiWindowFlags_NoTitleBar;
-
-	if (this->showFPS == true) {
-		ImGui::Begin("Frame Rate", &this->showFPS, FPSwindowFlags);
-
-		static float fps[90] = {};
-		static float frameTime[90] = {};
-		static float reflectionRenderTime[90] = {};
-		static float forwardRenderTime[90] = {};
-		static float MSPostProcessRenderTime[90] = {};
-		static float postProcessRenderTime[90] = {};
-		static int values_offset = 0;
-		static double refresh_time = 0.0;
-
-		if (refresh_time == 0) {
-			refresh_time = ImGui::GetTime();
-		}
-
-		while (refresh_time < ImGui::GetTime()) {
-			fps[values_offset] = 1.0f / this->fpsTime.asSeconds();
-			frameTime[values_offset] = this->fpsTime.asMicroseconds() / 1000.0f;
-			reflectionRenderTime[values_offset] = this->renderer->getReflectionRenderTime() * 1000.0f;
-			forwardRenderTime[values_offset] = this->renderer->getForwardRenderTime() * 1000.0f;
-			MSPostProcessRenderTime[values_offset] = this->renderer->getMSPostProcessingPassTime() * 1000.0f;
-			postProcessRenderTime[values_offset] = this->renderer->getPostProcessingPassTime() * 1000.0f;
-			values_offset = (values_offset + 1) % IM_ARRAYSIZE(fps);
-			refresh_time += 1.0f / 10.0f;
-		}
-
-		char overlay[32];
-		sprintf(overlay, "FPS %.0f", fps[(values_offset - 1) % IM_ARRAYSIZE(fps)]);
-
-		ImGui::PushItemWidth(-1);
-		ImGui::PlotLines("###fpsGraph", fps, IM_ARRAYSIZE(fps), values_offset, overlay, 0.0f, 300.0f, ImVec2(0, 40.0f));
-		ImGui::PopItemWidth();
-
-		sprintf(overlay, "Frame Time %.3f", frameTime[(values_offset - 1) % IM_ARRAYSIZE(frameTime)]);
-
-		ImGui::PushItemWidth(-1);
-		ImGui::PlotLines("###frameTimeGraph", frameTime, IM_ARRAYSIZE(frameTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
-		ImGui::PopItemWidth();
-
-
-		ImGui::Separator();
-
-		if (ImGui::CollapsingHeader("More Info")) {
-
-			sprintf(overlay, "Reflection %.3f", reflectionRenderTime[(values_offset - 1) % IM_ARRAYSIZE(reflectionRenderTime)]);
-
-			ImGui::PushItemWidth(-1);
-			ImGui::PlotLines("###reflectionGraph", reflectionRenderTime, IM_ARRAYSIZE(reflectionRenderTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
-			ImGui::PopItemWidth();
-
-			sprintf(overlay, "Forward %.3f", forwardRenderTime[(values_offset - 1) % IM_ARRAYSIZE(forwardRenderTime)]);
-
-			ImGui::PushItemWidth(-1);
-			ImGui::PlotLines("###forwardGraph", forwardRenderTime, IM_ARRAYSIZE(forwardRenderTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
-			ImGui::PopItemWidth();
-
-			sprintf(overlay, "MS Post %.3f", MSPostProcessRenderTime[(values_offset - 1) % IM_ARRAYSIZE(MSPostProcessRenderTime)]);
-
-			ImGui::PushItemWidth(-1);
-			ImGui::PlotLines("###MSPostGraph", MSPostProcessRenderTime, IM_ARRAYSIZE(MSPostProcessRenderTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
-			ImGui::PopItemWidth();
-
-			sprintf(overlay, "Post Process %.3f", postProcessRenderTime[(values_offset - 1) % IM_ARRAYSIZE(postProcessRenderTime)]);
-
-			ImGui::PushItemWidth(-1);
-			ImGui::PlotLines("###postProcessGraph", postProcessRenderTime, IM_ARRAYSIZE(postProcessRenderTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
-			ImGui::PopItemWidth();
-		}
-
-
-		ImGui::SetWindowSize(ImVec2(200.0f, 0.0f));
-
-		if (this->showRightColumn) {
-			ImGui::SetWindowPos(ImVec2(screenWidth - ImGui::GetWindowSize().x - this->rightColumnSize.x, 0 + this->menuBarSize.y));
-		}
-		else {
-			ImGui::SetWindowPos(ImVec2(screenWidth - ImGui::GetWindowSize().x, 0 + this->menuBarSize.y));
-		}
-		
-
-		static ImGuiStyle& style = ImGui::GetStyle();
-
-		style.WindowRounding = 0;
-		style.WindowBorderSize = 0;
-
-		ImGui::End();
-	}
-
-
-}
-
-void UI::drawMenuBar() {
-	if (ImGui::BeginMainMenuBar()) {
-		if (ImGui::BeginMenu("File")) {
-			if (ImGui::MenuItem("Close", "ALT + F4")) {
-				glfwSetWindowShouldClose(this->window, GL_TRUE);
-			}
-			ImGui::EndMenu();
-		}
-
-		if (ImGui::BeginMenu("Edit")) {
-
-			ImGui::EndMenu();
-		}
-
-		if (ImGui::BeginMenu("View")) {
-			if (ImGui::MenuItem("FPS", NULL, &this->showFPS));
-			if (ImGui::MenuItem("Left Column", NULL, &this->showLeftColumn));
-			if (ImGui::MenuItem("Right Column", NULL, &this->showRightColumn));
-
-			ImGui::EndMenu();
-		}
-
-		if (ImGui::BeginMenu("ImGui")) {
-			if (ImGui::MenuItem("Metrics Window", NULL, &this->showMetricsWindow));
-
-			if (ImGui::MenuItem("User Guide", NULL, &this->showUserGuide));
-
-			if (ImGui::MenuItem("About Window", NULL, &this->showAboutWindow));
-
-			if (ImGui::MenuItem("Demo", NULL, &this->showDemoWindow));
-
-			ImGui::EndMenu();
-		}
-
-		this->menuBarSize = ImGui::GetWindowSize();
-
-		ImGui::EndMainMenuBar();
-	}
-
-	if (this->showMetricsWindow == true) {
-		ImGui::ShowMetricsWindow(&this->showMetricsWindow);
-	}
-
-	if (this->showUserGuide == true) {
-		ImGui::ShowUserGuide();
-	}
-
-	if (this->showAboutWindow == true) {
-		ImGui::ShowAboutWindow(&this->showAboutWindow);
-	}
-
-	if (this->showDemoWindow == true) {
-		ImGui::ShowDemoWindow(&this->showAboutWindow);
-	}
-
-	if (this->pauseFlag == true) {
-		this->eventHandler->setUpdateFlag(false);
-	}
-	else {
-		this->eventHandler->setUpdateFlag(true);
-	}
-}
-
-void UI::drawImGui() {
-	ImGui_ImplOpenGL3_NewFrame();
-	ImGui_ImplGlfw_NewFrame();
-	ImGui::NewFrame();
-
-	this->drawMenuBar();
-
-	if (this->showLeftColumn == true) {
-		this->drawLeftColumn();
-	}
-
-	if (this->showRightColumn == true) {
-		this->drawRightColumn();
-	}
-
-	if (this->showBottomRow == true) {
-		this->drawBottomRow();
-	}
-
-	this->drawFPSWindow();
-
-	ImGui::Render();
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-}
-
-// just calls all the other methods, this method is public
-void UI::drawInfo() {
-	this->fpsTime = this->fpsClock.getElapsedTime();
-	this->fpsClock.restart().asSeconds();
-
-	if (displayInfo) {
-		this->drawImGui();
-	}
-
-	if (updated) {
-		updateResolution = false;
-	}
-	
-	updated = false;
-}
-
+#include "ui.h"
+#include "init.h"
+#include "entity.h"
+#include <stdlib.h>
+#include <vector>
+#include <string>
+#include <math.h>
+#include <sstream>
+#include <iomanip>
+#include "imgui.h"
+#include "imgui_impl_glfw.h"
+#include "imgui_impl_opengl3.h"
+#include "renderer.h"
+#include "eventHandler.h"
+#include "GLFW/glfw3.h"
+#include <SFML/Graphics.hpp>
+#include <stdio.h>
+#include <algorithm>
+
+// initialize the fields and formats the texts styles
+UI::UI(GLFWwindow *window, Renderer* renderer, EventHandler* eventHandler) {
+	// get the window reference
+	this->window = window;
+	this->renderer = renderer;
+	this->eventHandler = eventHandler;
+
+	// setup the update clock
+	this->tick = sf::milliseconds(1000 / 10);
+	this->time = this->clock.getElapsedTime();
+
+	this->showMetricsWindow = false;
+	this->showUserGuide = false;
+	this->showAboutWindow = false;
+	this->showDemoWindow = false;
+	this->showFPS = true;
+	this->showProfiler = false;
+	this->pauseFlag = false;
+	this->showLeftColumn = true;
+	this->showRightColumn = true;
+	this->showBottomRow = true;
+
+	//ImGui::SFML::Init(*this->window);
+	ImGui::CreateContext();
+	ImGui_ImplGlfw_InitForOpenGL(window, true);
+	ImGui_ImplOpenGL3_Init();
+	ImGuiIO& io = ImGui::GetIO();
+
+	io.FontDefault = io.Fonts->AddFontFromFileTTF("../Fonts/OpenSans/OpenSans-Regular.ttf", 18.0f);
+
+	this->setupImGuiStyle();
+}
+
+void UI::setReferenceWindow(GLFWwindow *window) {
+	this->window = window;
+}
+
+void UI::setupImGuiStyle() {
+	ImGuiStyle& style = ImGui::GetStyle();
+	style.FrameRounding = 0.0f;
+	ImVec4* colors = ImGui::GetStyle().Colors;
+	colors[ImGuiCol_Text] = ImVec4(1.00f, 1.00f, 1.00f, 1.00f);
+	colors[ImGuiCol_TextDisabled] = ImVec4(0.50f, 0.50f, 0.50f, 1.00f);
+	colors[ImGuiCol_WindowBg] = ImVec4(0.08f, 0.08f, 0.08f, 0.94f);
+	colors[ImGuiCol_ChildBg] = ImVec4(0.00f, 0.00f, 0.00f, 0.00f);
+	colors[ImGuiCol_PopupBg] = ImVec4(0.08f, 0.08f, 0.08f, 0.94f);
+	colors[ImGuiCol_Border] = ImVec4(0.43f, 0.43f, 0.50f, 0.50f);
+	colors[ImGuiCol_BorderShadow] = ImVec4(0.00f, 0.00f, 0.00f, 0.00f);
+	colors[ImGuiCol_FrameBg] = ImVec4(0.18f, 0.18f, 0.18f, 0.94f);
+	colors[ImGuiCol_FrameBgHovered] = ImVec4(0.00f, 0.45f, 1.00f, 1.00f);
+	colors[ImGuiCol_FrameBgActive] = ImVec4(0.18f, 0.61f, 1.00f, 1.00f);
+	colors[ImGuiCol_TitleBg] = ImVec4(0.18f, 0.18f, 0.18f, 1.00f);
+	colors[ImGuiCol_TitleBgActive] = ImVec4(0.00f, 0.52f, 1.00f, 1.00f);
+	colors[ImGuiCol_TitleBgCollapsed] = ImVec4(0.00f, 0.00f, 0.00f, 0.51f);
+	colors[ImGuiCol_MenuBarBg] = ImVec4(0.17f, 0.17f, 0.17f, 0.48f);
+	colors[ImGuiCol_ScrollbarBg] = ImVec4(0.02f, 0.02f, 0.02f, 0.53f);
+	colors[ImGuiCol_ScrollbarGrab] = ImVec4(0.31f, 0.31f, 0.31f, 1.00f);
+	colors[ImGuiCol_ScrollbarGrabHovered] = ImVec4(0.41f, 0.41f, 0.41f, 1.00f);
+	colors[ImGuiCol_ScrollbarGrabActive] = ImVec4(0.51f, 0.51f, 0.51f, 1.00f);
+	colors[ImGuiCol_CheckMark] = ImVec4(0.00f, 0.62f, 1.00f, 1.00f);
+	colors[ImGuiCol_SliderGrab] = ImVec4(0.61f, 0.61f, 0.61f, 1.00f);
+	colors[ImGuiCol_SliderGrabActive] = ImVec4(0.82f, 0.82f, 0.82f, 1.00f);
+	colors[ImGuiCol_Button] = ImVec4(0.00f, 0.45f, 1.00f, 1.00f);
+	colors[ImGuiCol_ButtonHovered] = ImVec4(0.21f, 0.57f, 1.00f, 1.00f);
+	colors[ImGuiCol_ButtonActive] = ImVec4(0.34f, 0.64f, 1.00f, 1.00f);
+	colors[ImGuiCol_Header] = ImVec4(0.18f, 0.18f, 0.18f, 0.94f);
+	colors[ImGuiCol_HeaderHovered] = ImVec4(0.00f, 0.45f, 1.00f, 1.00f);
+	colors[ImGuiCol_HeaderActive] = ImVec4(0.18f, 0.61f, 1.00f, 1.00f);
+	colors[ImGuiCol_Separator] = ImVec4(0.43f, 0.43f, 0.50f, 0.50f);
+	colors[ImGuiCol_SeparatorHovered] = ImVec4(0.00f, 1.00f, 0.18f, 0.78f);
+	colors[ImGuiCol_SeparatorActive] = ImVec4(0.10f, 0.40f, 0.75f, 1.00f);
+	colors[ImGuiCol_ResizeGrip] = ImVec4(0.00f, 0.00f, 0.00f, 0.00f);
+	colors[ImGuiCol_ResizeGripHovered] = ImVec4(0.26f, 0.59f, 0.98f, 0.00f);
+	colors[ImGuiCol_ResizeGripActive] = ImVec4(0.26f, 0.59f, 0.98f, 0.00f);
+	colors[ImGuiCol_Tab] = ImVec4(0.18f, 0.18f, 0.18f, 0.94f);
+	colors[ImGuiCol_TabHovered] = ImVec4(0.18f, 0.61f, 1.00f, 1.00f);
+	colors[ImGuiCol_TabActive] = ImVec4(0.00f, 0.45f, 1.00f, 1.00f);
+	colors[ImGuiCol_TabUnfocused] = ImVec4(0.07f, 0.10f, 0.15f, 0.97f);
+	colors[ImGuiCol_TabUnfocusedActive] = ImVec4(0.14f, 0.26f, 0.42f, 1.00f);
+	colors[ImGuiCol_PlotLines] = ImVec4(0.00f, 0.65f, 1.00f, 1.00f);
+	colors[ImGuiCol_PlotLinesHovered] = ImVec4(1.00f, 0.43f, 0.35f, 1.00f);
+	colors[ImGuiCol_PlotHistogram] = ImVec4(0.90f, 0.70f, 0.00f, 1.00f);
+	colors[ImGuiCol_PlotHistogramHovered] = ImVec4(1.00f, 0.60f, 0.00f, 1.00f);
+	colors[ImGuiCol_TextSelectedBg] = ImVec4(0.00f, 0.46f, 1.00f, 0.35f);
+	colors[ImGuiCol_DragDropTarget] = ImVec4(1.00f, 1.00f, 0.00f, 0.90f);
+	colors[ImGuiCol_NavHighlight] = ImVec4(0.26f, 0.59f, 0.98f, 1.00f);
+	colors[ImGuiCol_NavWindowingHighlight] = ImVec4(1.00f, 1.00f, 1.00f, 0.70f);
+	colors[ImGuiCol_NavWindowingDimBg] = ImVec4(0.80f, 0.80f, 0.80f, 0.20f);
+	colors[ImGuiCol_ModalWindowDimBg] = ImVec4(0.80f, 0.80f, 0.80f, 0.35f);
+}
+
+void UI::drawLeftColumn() {
+	static bool firstDraw = true;
+	static Entity *selectedEntity;
+	static int selected = -1;
+
+	static ImGuiWindowFlags leftColumnWindowFlags = ImGuiWindowFlags_NoMove |
+		//ImGuiWindowFlags_NoResize |
+		ImGuiWindowFlags_NoCollapse |
+		ImGuiWindowFlags_NoSavedSettings |
+		ImGuiWindowFlags_NoTitleBar;
+
+	ImGui::SetNextWindowSizeConstraints(ImVec2(0, -1), ImVec2(FLT_MAX, -1));
+
+	ImGui::Begin("Left Column", NULL, leftColumnWindowFlags);
+
+	if (ImGui::CollapsingHeader("Entities")) {
+		// the selected entity is outlined through its stencil id, the entities after the first OUTLINE_STENCIL_IDS
+		// don't have one and are outlined as wireframe
+		for (int i = 0; i < entityBuffer.size(); i++) {
+			if (ImGui::Selectable(entityBuffer[i]->getName().c_str(), selected == i)) {
+				if (selected == i) {
+					selected = -1;
+					selectedEntity = NULL;
+				}
+				else {
+					selectedEntity = entityBuffer[i];
+					selected = i;
+				}
+			}
+		}
+	}
+
+	// cost of the entity draws per frame, summed per entity or per shader, sorted by the column that was clicked last
+	if (ImGui::CollapsingHeader("Draw Cost")) {
+		static int grouping = 0;
+		static int sortColumn = 1;
+		static bool descending = true;
+
+		DrawProfiler* drawProfiler = this->renderer->getDrawProfiler();
+
+		ImGui::Checkbox("Measure Draws", &drawStatistics);
+		ImGui::RadioButton("Entity", &grouping, 0);
+		ImGui::SameLine();
+		ImGui::RadioButton("Shader", &grouping, 1);
+
+		if (drawStatistics) {
+			std::vector<drawCost_t> costs = grouping == 0 ? drawProfiler->getEntityCosts() : drawProfiler->getShaderCosts();
+
+			std::sort(costs.begin(), costs.end(), [](const drawCost_t& a, const drawCost_t& b) {
+				double values[2][5] = {
+					{ 0.0, a.gpuTime, a.vertices, a.primitives, a.fragments },
+					{ 0.0, b.gpuTime, b.vertices, b.primitives, b.fragments }
+				};
+
+				if (sortColumn == 0) {
+					return(descending ? a.name > b.name : a.name < b.name);
+				}
+
+				return(descending ? values[0][sortColumn] > values[1][sortColumn] : values[0][sortColumn] < values[1][sortColumn]);
+			});
+
+			const char* columns[] = { "Name", "ms", "Verts", "Prims", "Frags" };
+
+			ImGui::Columns(IM_ARRAYSIZE(columns), "###drawCostColumns");
+			ImGui::Separator();
+
+			for (int i = 0; i < IM_ARRAYSIZE(columns); i++) {
+				std::string header = std::string(columns[i]) + (sortColumn == i ? (descending ? " v" : " ^") : "");
+
+				if (ImGui::Selectable(header.c_str())) {
+					descending = sortColumn == i ? !descending : true;
+					sortColumn = i;
+				}
+
+				ImGui::NextColumn();
+			}
+
+			ImGui::Separator();
+
+			for (int i = 0; i < costs.size(); i++) {
+				ImGui::Text("%s", costs[i].name.c_str());
+				ImGui::NextColumn();
+				ImGui::Text("%.3f", costs[i].gpuTime * 1000.0);
+				ImGui::NextColumn();
+
+				// the counts don't fit the column, they're shown in thousands
+				double counts[3] = { costs[i].vertices, costs[i].primitives, costs[i].fragments };
+
+				for (int j = 0; j < 3; j++) {
+					if (drawProfiler->hasStatistics()) {
+						ImGui::Text("%.0fk", counts[j] / 1000.0);
+					}
+					else {
+						ImGui::TextDisabled("-");
+					}
+
+					ImGui::NextColumn();
+				}
+			}
+
+			ImGui::Columns(1);
+			ImGui::Separator();
+
+			if (drawProfiler->getUnmeasuredDraws() > 0) {
+				ImGui::TextDisabled("%d draws not measured", drawProfiler->getUnmeasuredDraws());
+			}
+
+			if (drawProfiler->getDroppedFrames() > 0) {
+				ImGui::TextDisabled("%d frames dropped", drawProfiler->getDroppedFrames());
+			}
+		}
+	}
+
+	ImGui::Separator();
+
+	if (selectedEntity != NULL) {
+		ImGui::Text(std::string("Entity: ").append(selectedEntity->getName()).c_str());
+		if (ImGui::CollapsingHeader("Properties")) {
+			
+			if (ImGui::TreeNode("Position")) {
+				float x = selectedEntity->getWorldPosition().x;
+				ImGui::DragFloat("X", &x, 0.005f);
+				float y = selectedEntity->getWorldPosition().y;
+				ImGui::DragFloat("Y", &y, 0.005f);
+				float z = selectedEntity->getWorldPosition().z;
+				ImGui::DragFloat("Z", &z, 0.005f);
+
+				selectedEntity->placeAt(glm::vec3(x, y, z), camera.getViewMatrix());
+
+				ImGui::TreePop();
+			}
+
+			if (ImGui::TreeNode("Rotation")) {
+				float x = selectedEntity->getRotationFactor().x;
+				ImGui::DragFloat("X", &x, 0.02f);
+				float y = selectedEntity->getRotationFactor().y;
+				ImGui::DragFloat("Y", &y, 0.02f);
+				float z = selectedEntity->getRotationFactor().z;
+				ImGui::DragFloat("Z", &z, 0.02f);
+
+				selectedEntity->setRotation(x, y, z);
+
+				ImGui::TreePop();
+			}
+
+			if (ImGui::TreeNode("Scale")) {
+				float x = selectedEntity->getScalingFactor().x;
+				if (ImGui::DragFloat("X", &x, 0.005f));
+				float y = selectedEntity->getScalingFactor().y;
+				if (ImGui::DragFloat("Y", &y, 0.005f));
+				float z = selectedEntity->getScalingFactor().z;
+				if (ImGui::DragFloat("Z", &z, 0.005f));
+
+				selectedEntity->setScale(glm::vec3(x, y, z));
+			}
+
+			ImGui::Separator();
+
+			std::vector<char*> shaderNames;
+
+			for (int i = 0; i < shaderBuffer.size(); i++) {
+				shaderNames.push_back(shaderBuffer[i].getName());
+			}
+
+			static int item_current;
+			char** Carray = shaderNames.data();
+
+			size_t arraySize = shaderNames.size();
+
+			item_current = selectedEntity->getShader();
+
+			ImGui::Text("Shader");
+			ImGui::SameLine();
+			ImGui::Combo("###ShaderDropdown", &item_current, Carray, arraySize);
+
+			selectedEntity->setShader(item_current);
+
+			std::vector<char*> outlineNames;
+
+			outlineNames.push_back((char*)"Solid");
+			outlineNames.push_back((char*)"Alpha");
+			outlineNames.push_back((char*)"Wireframe");
+
+			char** outlineCarray = outlineNames.data();
+
+			size_t outlineArraySize = outlineNames.size();
+
+			static int outlineCurrent = outlineType;
+
+			ImGui::Text("Outline");
+			ImGui::SameLine();
+			ImGui::Combo("###OutlineDropdown", &outlineCurrent, outlineCarray, outlineArraySize);
+
+			outlineType = outlineCurrent;
+
+			if (outlineType == 0 || outlineType == 1) {
+				ImGui::PushItemWidth(-1);
+				ImGui::SliderFloat("###OutlineWidth", &outlineWidth, 1.0f, (float)OUTLINE_MAX_WIDTH, "Width %.0f px");
+				ImGui::ColorEdit3("###OutlineColor", &outlineColor[0]);
+				ImGui::PopItemWidth();
+			}
+		}
+	}
+
+	ImGui::PushStyleColor(ImGuiCol_ResizeGrip, 0);
+
+	if (firstDraw) {
+		ImGui::SetWindowSize(ImVec2(250, screenHeight - this->menuBarSize.y));
+		firstDraw = false;
+	}
+	
+	if (updateResolution) {
+		ImGui::SetWindowSize(ImVec2(ImGui::GetWindowWidth(), screenHeight - this->menuBarSize.y));
+	}
+
+	this->leftColumnSize = ImGui::GetWindowSize();
+
+	this->renderer->setHighlightedEntity(selected);
+	
+	ImGui::SetWindowPos(ImVec2(0, this->menuBarSize.y));
+
+	static ImGuiStyle& leftColumnStyle = ImGui::GetStyle();
+
+	leftColumnStyle.WindowRounding = 0;
+	leftColumnStyle.WindowBorderSize = 0;
+
+	ImGui::End();
+}
+
+void UI::drawRightColumn() {
+	static bool firstDraw = true;
+	static Entity* selectedEntity;
+
+	static ImGuiWindowFlags rightColumnWindowFlags = ImGuiWindowFlags_NoMove |
+		//ImGuiWindowFlags_NoResize |
+		ImGuiWindowFlags_NoCollapse |
+		ImGuiWindowFlags_NoSavedSettings |
+		ImGuiWindowFlags_NoTitleBar;
+
+	ImGui::SetNextWindowSizeConstraints(ImVec2(0, -1), ImVec2(FLT_MAX, -1));
+
+	ImGui::Begin("Right Column", NULL, rightColumnWindowFlags);
+	static bool antialiasing = true;
+	if (ImGui::CollapsingHeader("Rendering Options")) {
+		bool tmp = vsync;
+		
+		if (ImGui::MenuItem("Pause", NULL, &this->pauseFlag));
+		if (ImGui::MenuItem("Render Real Time Reflections", NULL, &doReflection));
+		if (ImGui::MenuItem("Screen Space Reflections", NULL, &doScreenSpaceReflection));
+		if (ImGui::MenuItem("VSync", NULL, &vsync)) {
+			if (tmp != vsync) {
+				if (vsync == true) {
+					glfwSwapInterval(1);
+				}
+				else {
+					glfwSwapInterval(0);
+				}
+			}
+		}
+
+		tmp = fullscreen;
+		if (ImGui::MenuItem("Fullscreen", NULL, &fullscreen)) {
+			if (tmp != fullscreen) {
+				if (fullscreen == true) {
+					GLFWmonitor* monitor = glfwGetPrimaryMonitor();
+					const GLFWvidmode* mode = glfwGetVideoMode(monitor);
+					glfwSetWindowMonitor(this->window, monitor, 0, 0, mode->width, mode->height, mode->refreshRate);
+
+					int width;
+					int height;
+					glfwGetFramebufferSize(window, &width, &height);
+					glViewport(0, 0, mode->width, mode->height);
+					screenWidth = mode->width;
+					screenHeight = mode->height;
+					updateResolution = true;
+				}
+				else {
+					glfwSetWindowMonitor(this->window, NULL, 0, 0, windowWidth, windowHeight, 60);
+					glfwSetWindowPos(this->window, 40, 40);
+
+					int width;
+					int height;
+					glfwGetFramebufferSize(window, &width, &height);
+					glViewport(0, 0, width, height);
+					screenWidth = width;
+					screenHeight = height;
+					updateResolution = true;
+				}
+			}
+
+		}
+
+		if (ImGui::MenuItem("Depth Buffer", NULL, &depthBuffer));
+
+		// the renderer picks up the new mode on the next frame and recreates its multisampled targets
+		const char* items[] = {"Off", "MSAA 2x", "MSAA 4x", "MSAA 8x", "FXAA", "TAA"};
+		int currentAntiAliasing = antiAliasing;
+
+		ImGui::Text("MSAA");
+		ImGui::SameLine();
+		if (ImGui::Combo("###MSAADropdown", &currentAntiAliasing, items, IM_ARRAYSIZE(items))) {
+			antiAliasing = (antiAliasing_t)currentAntiAliasing;
+		}
+
+		// resolve the samples in a fragment shader instead of with a framebuffer blit
+		if (antiAliasing >= msaa2 && antiAliasing <= msaa8) {
+			if (ImGui::MenuItem("Shader Resolve", NULL, &shaderResolve));
+		}
+
+		// temporal anti-aliasing can render below the screen resolution and upsample through the history
+		if (antiAliasing == taa) {
+			if (ImGui::MenuItem("Temporal Upsampling", NULL, &taaUpsampling));
+
+			if (taaUpsampling) {
+				ImGui::Text("Input");
+				ImGui::SameLine();
+				ImGui::SliderFloat("###TAARenderScale", &taaRenderScale, 0.5f, 0.75f, "%.2f");
+			}
+
+			ImGui::Text("Feedback");
+			ImGui::SameLine();
+			ImGui::SliderFloat("###TAAFeedback", &taaFeedback, 0.02f, 0.5f, "%.2f");
+		}
+
+		// dynamic resolution adjusts the scale to hold the frame time, otherwise the scale is set by hand
+		if (ImGui::MenuItem("Dynamic Resolution", NULL, &dynamicResolution));
+
+		if (dynamicResolution) {
+			ImGui::Text("Target");
+			ImGui::SameLine();
+			ImGui::SliderFloat("###TargetFrameTime", &targetFrameTime, 4.0f, 33.3f, "%.1f ms");
+		}
+		else if (!(antiAliasing == taa && taaUpsampling) && !(antiAliasing != taa && upscaleQuality != noUpscaling)) {
+			ImGui::Text("Scale");
+			ImGui::SameLine();
+			ImGui::SliderFloat("###RenderScale", &renderScale, minRenderScale, 1.0f, "%.2f");
+		}
+
+		// spatial upscaling presets, the lower the quality the lower the resolution the scene is rendered at
+		if (antiAliasing != taa) {
+			const char* upscaleItems[] = {"Off", "Ultra Quality", "Quality", "Balanced", "Performance"};
+			int currentUpscaleQuality = upscaleQuality;
+
+			ImGui::Text("Upscaling");
+			ImGui::SameLine();
+			if (ImGui::Combo("###UpscalingDropdown", &currentUpscaleQuality, upscaleItems, IM_ARRAYSIZE(upscaleItems))) {
+				upscaleQuality = (upscaleQuality_t)currentUpscaleQuality;
+
+				if (upscaleQuality == noUpscaling && !dynamicResolution) {
+					renderScale = 1.0f;
+				}
+			}
+
+			if (upscaleQuality != noUpscaling) {
+				ImGui::Text("Sharpness");
+				ImGui::SameLine();
+				ImGui::SliderFloat("###UpscaleSharpness", &upscaleSharpness, 0.0f, 1.0f, "%.2f");
+			}
+		}
+
+		ImGui::Text("Render %dx%d (%.0f%%)", this->renderer->getRenderWidth(), this->renderer->getRenderHeight(), renderScale * 100.0f);
+		ImGui::Text("Targets %dx%d", this->renderer->getTargetWidth(), this->renderer->getTargetHeight());
+	}
+
+	if (ImGui::CollapsingHeader("Screen Space Reflections")) {
+		// every shader can receive screen space reflections, with its own reflectivity
+		for (int i = 0; i < shaderBuffer.size(); i++) {
+			bool screenSpaceReflection = shaderBuffer[i].getScreenSpaceReflection();
+			float reflectivity = shaderBuffer[i].getReflectivity();
+
+			ImGui::PushID(i);
+
+			if (ImGui::Checkbox(shaderBuffer[i].getName(), &screenSpaceReflection)) {
+				shaderBuffer[i].setScreenSpaceReflection(screenSpaceReflection);
+			}
+
+			if (screenSpaceReflection) {
+				ImGui::PushItemWidth(-1);
+				if (ImGui::SliderFloat("###Reflectivity", &reflectivity, 0.0f, 1.0f, "Reflectivity %.2f")) {
+					shaderBuffer[i].setReflectivity(reflectivity);
+				}
+				ImGui::PopItemWidth();
+			}
+
+			ImGui::PopID();
+		}
+	}
+
+	if (ImGui::CollapsingHeader("Post Processing")) {
+		std::vector<postProcessingStage_t>* stages = this->renderer->getPostProcessing()->getStages();
+		std::vector<int>* order = this->renderer->getPostProcessing()->getOrder();
+
+		// the stages are applied from top to bottom
+		for (int i = 0; i < order->size(); i++) {
+			postProcessingStage_t* stage = &(*stages)[(*order)[i]];
+
+			ImGui::PushID(i);
+
+			if (ImGui::ArrowButton("###Up", ImGuiDir_Up)) {
+				this->renderer->getPostProcessing()->moveStage(i, -1);
+			}
+			ImGui::SameLine();
+			if (ImGui::ArrowButton("###Down", ImGuiDir_Down)) {
+				this->renderer->getPostProcessing()->moveStage(i, 1);
+			}
+			ImGui::SameLine();
+			ImGui::Checkbox(stage->name.c_str(), &stage->enabled);
+
+			if (stage->enabled) {
+				ImGui::PushItemWidth(-1);
+				for (int j = 0; j < stage->parameterCount; j++) {
+					char format[64];
+					sprintf(format, "%s %%.2f", stage->parameterNames[j]);
+
+					ImGui::PushID(j);
+					ImGui::SliderFloat("###Parameter", &stage->parameters[j], stage->minimum[j], stage->maximum[j], format);
+					ImGui::PopID();
+				}
+				ImGui::PopItemWidth();
+			}
+
+			ImGui::PopID();
+		}
+
+		// what the chain is drawn as, with the GPU time of every pass
+		std::vector<postProcessingPass_t>* passes = this->renderer->getPostProcessing()->getPasses();
+
+		// blur and convolution passes can run as compute shaders, the benchmark times both paths on alternate frames
+		ImGui::Separator();
+
+		if (this->renderer->getPostProcessing()->isComputeAvailable()) {
+			ImGui::Checkbox("Compute Path", &computePostProcessing);
+			ImGui::Checkbox("Benchmark Paths", &postProcessingBenchmark);
+		}
+		else {
+			ImGui::TextWrapped("Compute path unavailable (OpenGL 4.3 needed)");
+		}
+
+		if (this->renderer->getPostProcessing()->isActive() && passes->size() > 0) {
+			ImGui::Separator();
+
+			if (postProcessingBenchmark) {
+				double fragmentTotal = 0.0;
+				double computeTotal = 0.0;
+
+				ImGui::Text("Passes (fragment / compute)");
+
+				for (int i = 0; i < passes->size(); i++) {
+					ImGui::TextWrapped("%d. %s: %.3f / %.3f ms", i + 1, (*passes)[i].label.c_str(), (*passes)[i].gpuTime * 1000.0, (*passes)[i].computeTime * 1000.0);
+					fragmentTotal += (*passes)[i].gpuTime;
+					computeTotal += (*passes)[i].computeTime;
+				}
+
+				ImGui::Text("Total: %.3f / %.3f ms", fragmentTotal * 1000.0, computeTotal * 1000.0);
+			}
+			else {
+				ImGui::Text("Passes");
+
+				for (int i = 0; i < passes->size(); i++) {
+					double time = computePostProcessing ? (*passes)[i].computeTime : (*passes)[i].gpuTime;
+					ImGui::TextWrapped("%d. %s: %.3f ms", i + 1, (*passes)[i].label.c_str(), time * 1000.0);
+				}
+			}
+		}
+	}
+
+	// passes of the last frame in order, the culled ones greyed out, with the memory of the render targets
+	if (ImGui::CollapsingHeader("Render Graph")) {
+		RenderGraph* renderGraph = this->renderer->getRenderGraph();
+		std::vector<renderPass_t>* passes = renderGraph->getPasses();
+
+		for (int i = 0; i < passes->size(); i++) {
+			if ((*passes)[i].culled) {
+				ImGui::TextDisabled("%d. %s (culled)", i + 1, (*passes)[i].name.c_str());
+			}
+			else {
+				ImGui::Text("%d. %s", i + 1, (*passes)[i].name.c_str());
+			}
+		}
+
+		ImGui::Separator();
+		ImGui::TextWrapped("Render targets: %.1f MB (%.1f MB without aliasing)", renderGraph->getMemory() / 1048576.0, renderGraph->getUnaliasedMemory() / 1048576.0);
+		ImGui::Text("Pooled textures: %d", renderGraph->getPoolSize());
+	}
+
+	// shaders are compiled again when their files change, a shader that fails keeps its old program and shows the errors
+	if (ImGui::CollapsingHeader("Shader Reload")) {
+		ShaderReloader* shaderReloader = this->renderer->getShaderReloader();
+		std::vector<shaderReload_t> reloads = shaderReloader->getReloads();
+
+		ImGui::Text("Watching %d shaders", shaderReloader->getWatchedCount());
+
+		if (shaderReloader->getReloadingCount() > 0) {
+			ImGui::Text("Compiling %d", shaderReloader->getReloadingCount());
+		}
+
+		// shaders whose first compilation failed are drawn with the fallback until a reload works
+		for (int i = 0; i < shaderBuffer.size(); i++) {
+			if (shaderBuffer[i].hasFailed()) {
+				ImGui::Separator();
+				ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%s: failed to compile", shaderBuffer[i].getName());
+				ImGui::TextWrapped("%s", shaderBuffer[i].getLog().c_str());
+			}
+		}
+
+		for (int i = 0; i < reloads.size(); i++) {
+			ImGui::Separator();
+
+			if (reloads[i].success) {
+				ImGui::TextWrapped("%s: reloaded", reloads[i].name.c_str());
+			}
+			else {
+				ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%s: failed", reloads[i].name.c_str());
+			}
+
+			if (!reloads[i].log.empty()) {
+				ImGui::TextWrapped("%s", reloads[i].log.c_str());
+			}
+		}
+	}
+
+	if (ImGui::CollapsingHeader("Bounding Box Display")) {
+		if (ImGui::MenuItem("Object Bounding Box", NULL, &drawOBB));
+		if (ImGui::MenuItem("External Axis Aligned Bounding Box", NULL, &drawAABB1));
+		if (ImGui::MenuItem("Internal Axis Aligned Bounding Box", NULL, &drawAABB2));
+		if (ImGui::MenuItem("Average Axis Aligned Bounding Box", NULL, &drawAABB3));
+		if (ImGui::MenuItem("True Axis Aligned Bounding Box", NULL, &drawAABB4));
+		if (ImGui::MenuItem("Internal Bounding Sphere", NULL, &drawBS));
+		if (ImGui::MenuItem("External Bounding Sphere", NULL, &drawBS2));
+		if (ImGui::MenuItem("True Bounding Sphere", NULL, &drawBS3));
+
+		DebugDraw* debugDraw = this->renderer->getDebugDraw();
+
+		ImGui::Separator();
+		ImGui::Text("%d lines, %d spheres", debugDraw->getVertexCount() / 2, debugDraw->getSphereCount());
+		ImGui::Text("%d draw calls (%s)", debugDraw->getDrawCalls(), debugDraw->isPersistent() ? "persistent ring" : "uploaded");
+	}
+
+	ImGui::PushStyleColor(ImGuiCol_ResizeGrip, 0);
+
+	if (firstDraw) {
+		ImGui::SetWindowSize(ImVec2(250, screenHeight - this->menuBarSize.y));
+		firstDraw = false;
+	}
+
+	if (updateResolution) {
+		ImGui::SetWindowSize(ImVec2(ImGui::GetWindowWidth(), screenHeight - this->menuBarSize.y));
+	}
+
+	ImGui::SetWindowPos(ImVec2(screenWidth - ImGui::GetWindowWidth(), this->menuBarSize.y));
+	this->rightColumnSize = ImGui::GetWindowSize();
+
+	static ImGuiStyle& rightColumnStyle = ImGui::GetStyle();
+
+	rightColumnStyle.WindowRounding = 0;
+	rightColumnStyle.WindowBorderSize = 0;
+
+	ImGui::End();
+}
+
+void UI::drawBottomRow() {
+	static bool firstDraw = true;
+
+	static ImGuiWindowFlags bottomRowFlags = ImGuiWindowFlags_NoMove |
+		//ImGuiWindowFlags_NoResize |
+		ImGuiWindowFlags_NoCollapse |
+		ImGuiWindowFlags_NoSavedSettings |
+		ImGuiWindowFlags_NoTitleBar;
+
+	ImGui::SetNextWindowSizeConstraints(ImVec2(-1, 0), ImVec2(-1, FLT_MAX));
+
+	ImGui::Begin("BottomRow", NULL, bottomRowFlags);
+	{
+		float height;
+		if (firstDraw) {
+			height = 200.0f;
+		}
+		else {
+			height = std::min(ImGui::GetWindowSize().y - 20.0f, 200.0f);
+		}
+
+		ImGui::BeginChild("Depth", ImVec2((float)screenWidth / (float)screenHeight * height, 0));
+		// the targets can be bigger than the screen, only their bottom left corner is shown
+		float depthU = (float)screenWidth / this->renderer->getTargetWidth();
+		float depthV = (float)screenHeight / this->renderer->getTargetHeight();
+		ImGui::Image((ImTextureID)this->renderer->getDepthBufferTexture(), ImVec2((float)screenWidth / (float)screenHeight * height, height), ImVec2(0, depthV), ImVec2(depthU, 0));
+		ImGui::EndChild();
+
+		ImGui::SameLine();
+
+		ImGui::BeginChild("Texture", ImVec2((float)screenWidth / (float)screenHeight * height, 0));
+		ImGui::Image((ImTextureID)entityBuffer[3]->getTexture(), ImVec2((float)screenWidth / (float)screenHeight * height, height), ImVec2(0, 1), ImVec2(1, 0));
+		ImGui::EndChild();
+	}
+
+	if (firstDraw) {
+		ImGui::SetWindowSize(ImVec2(screenWidth - 500, 220));
+		firstDraw = false;
+	}
+	else {
+		ImGui::SetWindowSize(ImVec2(screenWidth - this->leftColumnSize.x - this->rightColumnSize.x, ImGui::GetWindowSize().y));
+	}
+	
+	ImVec2 size = ImGui::GetWindowSize();
+
+	ImGui::SetWindowPos(ImVec2(this->leftColumnSize.x, screenHeight - size.y));
+
+	ImGui::End();
+}
+
+void UI::drawFPSWindow() {
+	static ImGuiWindowFlags FPSwindowFlags = ImGuiWindowFlags_NoMove |
+		ImGuiWindowFlags_NoResize |
+		ImGuiWindowFlags_NoCollapse |
+		ImGuiWindowFlags_NoSavedSettings |
+		ImGuiWindowFlags_NoTitleBar;
+
+	if (this->showFPS == true) {
+		ImGui::Begin("Frame Rate", &this->showFPS, FPSwindowFlags);
+
+		static float fps[90] = {};
+		static float frameTime[90] = {};
+		static float reflectionRenderTime[90] = {};
+		static float forwardRenderTime[90] = {};
+		static float MSPostProcessRenderTime[90] = {};
+		static float postProcessRenderTime[90] = {};
+		static float ssrRenderTime[90] = {};
+		static float gpuFrameTime[90] = {};
+		static float cpuFrameTime[90] = {};
+		static float taaRenderTime[90] = {};
+		// CPU time spent submitting the passes, shown next to their GPU time
+		static float reflectionCPUTime = 0.0f;
+		static float forwardCPUTime = 0.0f;
+		static float MSPostProcessCPUTime = 0.0f;
+		static float postProcessCPUTime = 0.0f;
+		static float ssrCPUTime = 0.0f;
+		static float taaCPUTime = 0.0f;
+		// averaged cost of every anti-aliasing mode, kept from the last time each one was active
+		static float antiAliasingFrameTime[6] = {};
+		static float antiAliasingResolveTime[6] = {};
+		static int values_offset = 0;
+		static double refresh_time = 0.0;
+
+		if (refresh_time == 0) {
+			refresh_time = ImGui::GetTime();
+		}
+
+		while (refresh_time < ImGui::GetTime()) {
+			fps[values_offset] = 1.0f / this->fpsTime.asSeconds();
+			frameTime[values_offset] = this->fpsTime.asMicroseconds() / 1000.0f;
+			reflectionRenderTime[values_offset] = this->renderer->getReflectionRenderTime(true) * 1000.0f;
+			forwardRenderTime[values_offset] = this->renderer->getForwardRenderTime(true) * 1000.0f;
+			MSPostProcessRenderTime[values_offset] = this->renderer->getMSPostProcessingPassTime(true) * 1000.0f;
+			postProcessRenderTime[values_offset] = this->renderer->getPostProcessingPassTime(true) * 1000.0f;
+			ssrRenderTime[values_offset] = this->renderer->getSSRPassTime(true) * 1000.0f;
+			gpuFrameTime[values_offset] = this->renderer->getGPUFrameTime() * 1000.0f;
+			cpuFrameTime[values_offset] = this->renderer->getCPUFrameTime() * 1000.0f;
+			taaRenderTime[values_offset] = this->renderer->getTAAPassTime(true) * 1000.0f;
+
+			reflectionCPUTime = this->renderer->getReflectionRenderTime(false) * 1000.0f;
+			forwardCPUTime = this->renderer->getForwardRenderTime(false) * 1000.0f;
+			MSPostProcessCPUTime = this->renderer->getMSPostProcessingPassTime(false) * 1000.0f;
+			postProcessCPUTime = this->renderer->getPostProcessingPassTime(false) * 1000.0f;
+			ssrCPUTime = this->renderer->getSSRPassTime(false) * 1000.0f;
+			taaCPUTime = this->renderer->getTAAPassTime(false) * 1000.0f;
+
+			// the resolve cost of a mode is the multisample resolve plus the final screen pass, where FXAA runs, and the TAA pass
+			float resolveTime = MSPostProcessRenderTime[values_offset] + postProcessRenderTime[values_offset] + taaRenderTime[values_offset];
+			antiAliasingFrameTime[antiAliasing] = antiAliasingFrameTime[antiAliasing] * 0.9f + frameTime[values_offset] * 0.1f;
+			antiAliasingResolveTime[antiAliasing] = antiAliasingResolveTime[antiAliasing] * 0.9f + resolveTime * 0.1f;
+
+			values_offset = (values_offset + 1) % IM_ARRAYSIZE(fps);
+			refresh_time += 1.0f / 10.0f;
+		}
+
+		char overlay[32];
+		sprintf(overlay, "FPS %.0f", fps[(values_offset + IM_ARRAYSIZE(fps) - 1) % IM_ARRAYSIZE(fps)]);
+
+		ImGui::PushItemWidth(-1);
+		ImGui::PlotLines("###fpsGraph", fps, IM_ARRAYSIZE(fps), values_offset, overlay, 0.0f, 300.0f, ImVec2(0, 40.0f));
+		ImGui::PopItemWidth();
+
+		sprintf(overlay, "Frame Time %.3f", frameTime[(values_offset + IM_ARRAYSIZE(frameTime) - 1) % IM_ARRAYSIZE(frameTime)]);
+
+		ImGui::PushItemWidth(-1);
+		ImGui::PlotLines("###frameTimeGraph", frameTime, IM_ARRAYSIZE(frameTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
+		ImGui::PopItemWidth();
+
+		// the side that takes longer to get through a frame is the one holding the frame rate back
+		float lastGPUTime = gpuFrameTime[(values_offset + IM_ARRAYSIZE(gpuFrameTime) - 1) % IM_ARRAYSIZE(gpuFrameTime)];
+		float lastCPUTime = cpuFrameTime[(values_offset + IM_ARRAYSIZE(cpuFrameTime) - 1) % IM_ARRAYSIZE(cpuFrameTime)];
+
+		if (lastGPUTime > lastCPUTime) {
+			ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.3f, 1.0f), "GPU bound");
+		}
+		else {
+			ImGui::TextColored(ImVec4(0.3f, 0.7f, 1.0f, 1.0f), "CPU bound");
+		}
+
+		ImGui::SameLine();
+		ImGui::Text("%.2f / %.2f", lastGPUTime, lastCPUTime);
+
+
+		ImGui::Separator();
+
+		if (ImGui::CollapsingHeader("More Info")) {
+
+			// GPU time of the passes from the timestamp queries, next to the CPU time spent submitting them (GPU / CPU ms)
+			sprintf(overlay, "GPU %.3f / %.3f", gpuFrameTime[(values_offset + IM_ARRAYSIZE(gpuFrameTime) - 1) % IM_ARRAYSIZE(gpuFrameTime)], cpuFrameTime[(values_offset + IM_ARRAYSIZE(cpuFrameTime) - 1) % IM_ARRAYSIZE(cpuFrameTime)]);
+
+			ImGui::PushItemWidth(-1);
+			ImGui::PlotLines("###gpuGraph", gpuFrameTime, IM_ARRAYSIZE(gpuFrameTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
+			ImGui::PopItemWidth();
+
+			sprintf(overlay, "Reflection %.3f / %.3f", reflectionRenderTime[(values_offset + IM_ARRAYSIZE(reflectionRenderTime) - 1) % IM_ARRAYSIZE(reflectionRenderTime)], reflectionCPUTime);
+
+			ImGui::PushItemWidth(-1);
+			ImGui::PlotLines("###reflectionGraph", reflectionRenderTime, IM_ARRAYSIZE(reflectionRenderTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
+			ImGui::PopItemWidth();
+
+			sprintf(overlay, "Forward %.3f / %.3f", forwardRenderTime[(values_offset + IM_ARRAYSIZE(forwardRenderTime) - 1) % IM_ARRAYSIZE(forwardRenderTime)], forwardCPUTime);
+
+			ImGui::PushItemWidth(-1);
+			ImGui::PlotLines("###forwardGraph", forwardRenderTime, IM_ARRAYSIZE(forwardRenderTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
+			ImGui::PopItemWidth();
+
+			sprintf(overlay, "MS Post %.3f / %.3f", MSPostProcessRenderTime[(values_offset + IM_ARRAYSIZE(MSPostProcessRenderTime) - 1) % IM_ARRAYSIZE(MSPostProcessRenderTime)], MSPostProcessCPUTime);
+
+			ImGui::PushItemWidth(-1);
+			ImGui::PlotLines("###MSPostGraph", MSPostProcessRenderTime, IM_ARRAYSIZE(MSPostProcessRenderTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
+			ImGui::PopItemWidth();
+
+			sprintf(overlay, "SSR %.3f / %.3f", ssrRenderTime[(values_offset + IM_ARRAYSIZE(ssrRenderTime) - 1) % IM_ARRAYSIZE(ssrRenderTime)], ssrCPUTime);
+
+			ImGui::PushItemWidth(-1);
+			ImGui::PlotLines("###SSRGraph", ssrRenderTime, IM_ARRAYSIZE(ssrRenderTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
+			ImGui::PopItemWidth();
+
+			sprintf(overlay, "TAA %.3f / %.3f", taaRenderTime[(values_offset + IM_ARRAYSIZE(taaRenderTime) - 1) % IM_ARRAYSIZE(taaRenderTime)], taaCPUTime);
+
+			ImGui::PushItemWidth(-1);
+			ImGui::PlotLines("###TAAGraph", taaRenderTime, IM_ARRAYSIZE(taaRenderTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
+			ImGui::PopItemWidth();
+
+			sprintf(overlay, "Post Process %.3f / %.3f", postProcessRenderTime[(values_offset + IM_ARRAYSIZE(postProcessRenderTime) - 1) % IM_ARRAYSIZE(postProcessRenderTime)], postProcessCPUTime);
+
+			ImGui::PushItemWidth(-1);
+			ImGui::PlotLines("###postProcessGraph", postProcessRenderTime, IM_ARRAYSIZE(postProcessRenderTime), values_offset, overlay, 0.0f, 60.0f, ImVec2(0, 40.0f));
+			ImGui::PopItemWidth();
+
+			ImGui::Separator();
+
+			// frame and resolve time (ms) of each anti-aliasing mode, only filled in once a mode has been used
+			const char* antiAliasingNames[] = {"Off", "MSAA 2x", "MSAA 4x", "MSAA 8x", "FXAA", "TAA"};
+
+			ImGui::Text("Anti-Aliasing cost");
+			for (int i = 0; i < IM_ARRAYSIZE(antiAliasingNames); i++) {
+				if (antiAliasingFrameTime[i] == 0.0f) {
+					ImGui::TextDisabled("%-8s -", antiAliasingNames[i]);
+				}
+				else if (i == antiAliasing) {
+					ImGui::Text("%-8s %.2f / %.3f", antiAliasingNames[i], antiAliasingFrameTime[i], antiAliasingResolveTime[i]);
+				}
+				else {
+					ImGui::TextDisabled("%-8s %.2f / %.3f", antiAliasingNames[i], antiAliasingFrameTime[i], antiAliasingResolveTime[i]);
+				}
+			}
+
+			ImGui::Separator();
+
+			// openGL calls of the renderer in the last frame, the elided ones were skipped by the state cache
+			int issuedCalls = glState->getIssuedCalls();
+			int elidedCalls = glState->getElidedCalls();
+
+			ImGui::Text("GL calls %d", issuedCalls);
+			ImGui::Text("Elided   %d (%.0f%%)", elidedCalls, issuedCalls + elidedCalls > 0 ? 100.0f * elidedCalls / (issuedCalls + elidedCalls) : 0.0f);
+			ImGui::Text("Cached locations %d", glState->getCachedLocations());
+			ImGui::Text("DSA      %s", glState->hasDirectStateAccess() ? "yes" : "no (bind to edit)");
+			// frames whose pass timings weren't back from the GPU when their queries were reused
+			ImGui::Text("Timer drops %d", this->renderer->getRenderGraph()->getTimer()->getDroppedFrames());
+			// time spent creating shader programs, restored from the cache or compiled
+			ImGui::Text("Shaders  %.1f ms (%d/%d cached)", shaderCache->getSetupTime() * 1000.0, shaderCache->getHits(), shaderCache->getHits() + shaderCache->getMisses());
+
+			if (shaderCache->getMisses() == 0 && shaderCache->getColdSetupTime() > 0.0) {
+				ImGui::Text("Cold     %.1f ms", shaderCache->getColdSetupTime() * 1000.0);
+			}
+
+			if (shaderCache->getRuntimePrograms() > 0) {
+				ImGui::Text("Runtime  %.1f ms (%d programs)", shaderCache->getRuntimeTime() * 1000.0, shaderCache->getRuntimePrograms());
+			}
+
+			// entity shaders still compiling in the background are drawn with the fallback shader
+			int readyShaders = 0;
+
+			for (int i = 0; i < shaderBuffer.size(); i++) {
+				readyShaders += shaderBuffer[i].isReady();
+			}
+
+			if (readyShaders < shaderBuffer.size()) {
+				ImGui::Text("Compiling %d/%d (%s)", (int)shaderBuffer.size() - readyShaders, (int)shaderBuffer.size(), Shader::hasParallelCompile() ? "parallel" : "serial");
+			}
+
+			MaterialTextures* materials = this->renderer->getMaterials();
+
+			if (materials->isBindless()) {
+				ImGui::Text("Materials %d (bindless)", materials->getMaterialCount());
+			}
+			else {
+				ImGui::Text("Materials %d (%d arrays)", materials->getMaterialCount(), materials->getArrayCount());
+			}
+
+			ImGui::Separator();
+
+			// entities can fetch their vertices from the mesh buffer instead of attributes, the benchmark times the
+			// forward pass draws of both paths on alternate frames (GPU / CPU ms)
+			MeshPool* meshPool = this->renderer->getMeshPool();
+
+			if (meshPool->isAvailable()) {
+				ImGui::Checkbox("Vertex Pulling", &vertexPulling);
+				ImGui::Checkbox("Benchmark Vertex Paths", &vertexPullingBenchmark);
+			}
+			else {
+				ImGui::Text("Vertex Pulling unavailable (no storage buffers)");
+			}
+
+			ImGui::Text("Attributes %.3f / %.3f", this->renderer->getForwardGPUTime(0) * 1000.0, this->renderer->getForwardCPUTime(0) * 1000.0);
+			ImGui::Text("Pulling    %.3f / %.3f", this->renderer->getForwardGPUTime(1) * 1000.0, this->renderer->getForwardCPUTime(1) * 1000.0);
+			ImGui::Text("Meshes %d (%.1f / %.1f MB)", meshPool->getMeshCount(), meshPool->getSize() * sizeof(float) / 1048576.0, meshPool->getCapacity() * sizeof(float) / 1048576.0);
+		}
+
+		// every frame of the last seconds, instead of the samples taken ten times a second above, with percentiles
+		// of the frame times (ms) and exports to ../frameStats.csv and .json
+		if (ImGui::CollapsingHeader("Frame Statistics")) {
+			static int window = 600;
+			static int captureLength = 1000;
+
+			FrameStats* frameStats = this->renderer->getFrameStats();
+			std::vector<frameSample_t> samples = frameStats->getSamples(240);
+			std::vector<float> frameTimes;
+
+			for (int i = 0; i < samples.size(); i++) {
+				frameTimes.push_back((float)samples[i].frameTime * 1000.0f);
+			}
+
+			ImGui::PushItemWidth(-1);
+
+			if (!frameTimes.empty()) {
+				ImGui::PlotHistogram("###frameStatsGraph", frameTimes.data(), frameTimes.size(), 0, NULL, 0.0f, 60.0f, ImVec2(0, 40.0f));
+			}
+
+			ImGui::SliderInt("###frameStatsWindow", &window, 60, FRAME_STATS_FRAMES, "Last %d frames");
+			ImGui::PopItemWidth();
+
+			frameMetric_t metrics[3] = { frameTimeMetric, cpuTimeMetric, gpuTimeMetric };
+			const char* metricNames[3] = { "Frame", "CPU", "GPU" };
+
+			ImGui::Text("      p50   p95   p99   max");
+
+			for (int i = 0; i < 3; i++) {
+				frameSummary_t summary = frameStats->summarize(metrics[i], window);
+				ImGui::Text("%-5s %5.2f %5.2f %5.2f %5.2f", metricNames[i], summary.p50 * 1000.0, summary.p95 * 1000.0, summary.p99 * 1000.0, summary.max * 1000.0);
+			}
+
+			ImGui::Text("1%% low %.1f fps", frameStats->getOnePercentLow(window));
+			ImGui::Text("Hitches %d", frameStats->getHitchCount());
+
+			std::vector<hitch_t> hitches = frameStats->getHitches();
+
+			for (int i = 0; i < hitches.size() && i < 3; i++) {
+				ImGui::TextDisabled("  #%d %.1f ms (%.1fx)", hitches[i].frame, hitches[i].frameTime * 1000.0, hitches[i].frameTime / hitches[i].median);
+			}
+
+			if (ImGui::Button("Export")) {
+				frameStats->exportFrames();
+			}
+
+			if (frameStats->isCapturing()) {
+				ImGui::TextDisabled("Recording, %d left", frameStats->getCaptureRemaining());
+			}
+			else {
+				ImGui::SameLine();
+
+				if (ImGui::Button("Record")) {
+					frameStats->captureFrames(captureLength);
+				}
+
+				ImGui::SameLine();
+				ImGui::PushItemWidth(-1);
+				ImGui::InputInt("###captureLength", &captureLength, 100);
+				ImGui::PopItemWidth();
+			}
+		}
+
+
+		ImGui::SetWindowSize(ImVec2(200.0f, 0.0f));
+
+		if (this->showRightColumn) {
+			ImGui::SetWindowPos(ImVec2(screenWidth - ImGui::GetWindowSize().x - this->rightColumnSize.x, 0 + this->menuBarSize.y));
+		}
+		else {
+			ImGui::SetWindowPos(ImVec2(screenWidth - ImGui::GetWindowSize().x, 0 + this->menuBarSize.y));
+		}
+		
+
+		static ImGuiStyle& style = ImGui::GetStyle();
+
+		style.WindowRounding = 0;
+		style.WindowBorderSize = 0;
+
+		ImGui::End();
+	}
+
+
+}
+
+// flame graph of the cpu zones of the last frame, a row of zones for every nesting level of every thread
+void UI::drawProfilerWindow() {
+	static bool freeze = false;
+	static std::vector<profileEvent_t> events;
+	static long long frameStart = 0;
+	static long long frameDuration = 1;
+
+	ImGui::SetNextWindowSize(ImVec2(700, 300), ImGuiCond_FirstUseEver);
+	ImGui::Begin("Profiler", &this->showProfiler);
+
+#if PROFILER
+	bool enabled = profiler->isEnabled();
+
+	if (ImGui::Checkbox("Enabled", &enabled)) {
+		profiler->setEnabled(enabled);
+	}
+
+	ImGui::SameLine();
+	ImGui::Checkbox("Freeze", &freeze);
+	ImGui::SameLine();
+
+	if (profiler->isCapturing()) {
+		ImGui::TextDisabled("Capturing %d frames...", PROFILER_CAPTURE_FRAMES);
+	}
+	else if (ImGui::Button("Export Chrome Trace")) {
+		profiler->captureTrace();
+	}
+
+	if (!freeze && profiler->getFrameDuration() > 0) {
+		events = profiler->getFrameEvents();
+		frameStart = profiler->getFrameStart();
+		frameDuration = profiler->getFrameDuration();
+	}
+
+	ImGui::Text("Frame %.3f ms, %d zones, %.0f ns per zone, overhead %.2f%%", frameDuration / 1000000.0, (int)events.size(), profiler->getZoneCost(), profiler->getOverhead());
+
+	if (profiler->getLostEvents() > 0) {
+		ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%d zones lost", profiler->getLostEvents());
+	}
+
+	ImGui::Separator();
+
+	// rows of every thread, in the order the threads show up
+	std::vector<int> threads;
+	std::vector<int> depths;
+
+	for (int i = 0; i < events.size(); i++) {
+		int thread = std::find(threads.begin(), threads.end(), events[i].thread) - threads.begin();
+
+		if (thread == threads.size()) {
+			threads.push_back(events[i].thread);
+			depths.push_back(0);
+		}
+
+		depths[thread] = std::max(depths[thread], events[i].depth + 1);
+	}
+
+	ImDrawList* drawList = ImGui::GetWindowDrawList();
+	float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+	float width = ImGui::GetContentRegionAvail().x;
+	ImVec2 mouse = ImGui::GetIO().MousePos;
+
+	for (int t = 0; t < threads.size(); t++) {
+		ImGui::Text("%s", profiler->getThreadName(threads[t]).c_str());
+
+		ImVec2 origin = ImGui::GetCursorScreenPos();
+		ImGui::Dummy(ImVec2(width, rowHeight * depths[t]));
+
+		for (int i = 0; i < events.size(); i++) {
+			profileEvent_t event = events[i];
+
+			if (event.thread != threads[t]) {
+				continue;
+			}
+
+			// zones that started before the frame, like the loading ones, are cut at its start
+			float start = std::max(0.0f, (float)(event.start - frameStart) / frameDuration) * width;
+			float end = std::min(1.0f, (float)(event.end - frameStart) / frameDuration) * width;
+			ImVec2 min = ImVec2(origin.x + start, origin.y + event.depth * rowHeight);
+			ImVec2 max = ImVec2(origin.x + std::max(end, start + 1.0f), min.y + rowHeight - 1.0f);
+
+			// the color follows the name, so a zone keeps it from frame to frame
+			float hue = (float)(std::hash<std::string>()(event.name) % 360) / 360.0f;
+			drawList->AddRectFilled(min, max, ImColor::HSV(hue, 0.5f, 0.7f));
+
+			if (max.x - min.x > 20.0f) {
+				drawList->PushClipRect(min, max, true);
+				drawList->AddText(ImVec2(min.x + 2.0f, min.y), IM_COL32(255, 255, 255, 255), event.name);
+				drawList->PopClipRect();
+			}
+
+			if (ImGui::IsWindowHovered() && mouse.x >= min.x && mouse.x < max.x && mouse.y >= min.y && mouse.y < max.y) {
+				ImGui::SetTooltip("%s\n%.3f ms", event.name, (event.end - event.start) / 1000000.0);
+			}
+		}
+	}
+#else
+	ImGui::TextWrapped("The profiler is compiled out, build with PROFILER set to 1 to record zones");
+#endif
+
+	ImGui::End();
+}
+
+void UI::drawMenuBar() {
+	if (ImGui::BeginMainMenuBar()) {
+		if (ImGui::BeginMenu("File")) {
+			if (ImGui::MenuItem("Close", "ALT + F4")) {
+				glfwSetWindowShouldClose(this->window, GL_TRUE);
+			}
+			ImGui::EndMenu();
+		}
+
+		if (ImGui::BeginMenu("Edit")) {
+
+			ImGui::EndMenu();
+		}
+
+		if (ImGui::BeginMenu("View")) {
+			if (ImGui::MenuItem("FPS", NULL, &this->showFPS));
+			if (ImGui::MenuItem("Profiler", NULL, &this->showProfiler));
+			if (ImGui::MenuItem("Left Column", NULL, &this->showLeftColumn));
+			if (ImGui::MenuItem("Right Column", NULL, &this->showRightColumn));
+
+			ImGui::EndMenu();
+		}
+
+		if (ImGui::BeginMenu("ImGui")) {
+			if (ImGui::MenuItem("Metrics Window", NULL, &this->showMetricsWindow));
+
+			if (ImGui::MenuItem("User Guide", NULL, &this->showUserGuide));
+
+			if (ImGui::MenuItem("About Window", NULL, &this->showAboutWindow));
+
+			if (ImGui::MenuItem("Demo", NULL, &this->showDemoWindow));
+
+			ImGui::EndMenu();
+		}
+
+		this->menuBarSize = ImGui::GetWindowSize();
+
+		ImGui::EndMainMenuBar();
+	}
+
+	if (this->showMetricsWindow == true) {
+		ImGui::ShowMetricsWindow(&this->showMetricsWindow);
+	}
+
+	if (this->showUserGuide == true) {
+		ImGui::ShowUserGuide();
+	}
+
+	if (this->showAboutWindow == true) {
+		ImGui::ShowAboutWindow(&this->showAboutWindow);
+	}
+
+	if (this->showDemoWindow == true) {
+		ImGui::ShowDemoWindow(&this->showAboutWindow);
+	}
+
+	if (this->pauseFlag == true) {
+		this->eventHandler->setUpdateFlag(false);
+	}
+	else {
+		this->eventHandler->setUpdateFlag(true);
+	}
+}
+
+void UI::drawImGui() {
+	ImGui_ImplOpenGL3_NewFrame();
+	ImGui_ImplGlfw_NewFrame();
+	ImGui::NewFrame();
+
+	this->drawMenuBar();
+
+	if (this->showLeftColumn == true) {
+		this->drawLeftColumn();
+	}
+
+	if (this->showRightColumn == true) {
+		this->drawRightColumn();
+	}
+
+	if (this->showBottomRow == true) {
+		this->drawBottomRow();
+	}
+
+	this->drawFPSWindow();
+
+	if (this->showProfiler == true) {
+		this->drawProfilerWindow();
+	}
+
+	ImGui::Render();
+	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+}
+
+// just calls all the other methods, this method is public
+void UI::drawInfo() {
+	PROFILE_ZONE("UI::drawInfo");
+
+	this->fpsTime = this->fpsClock.getElapsedTime();
+	this->fpsClock.restart().asSeconds();
+
+	if (displayInfo) {
+		this->drawImGui();
+	}
+
+	if (updated) {
+		updateResolution = false;
+	}
+	
+	updated = false;
+}
+
@@ -1,20 +1,34 @@
-#include "Libs/lib.h"
-
-int main(void) {
-	GLFWwindow* window = setup();
-	Renderer renderer;
-	EventHandler eventHandler(window);
-	UI interface(window, &renderer, &eventHandler);
-
-	while (!glfwWindowShouldClose(window)) {
-		eventHandler.routine();
-		renderer.render();
-		interface.drawInfo();
-		glfwPollEvents();
-		glfwSwapBuffers(window);
-	}
-
-	return(0);
-}
-
-
+#include "Libs/lib.h"
+
+int main(int argc, char** argv) {
+	Benchmark benchmark(argc, argv);
+	GLFWwindow* window = setup();
+	Renderer renderer;
+
+	if (headless) {
+		return(benchmark.run(window, &renderer));
+	}
+
+	EventHandler eventHandler(window);
+	UI interface(window, &renderer, &eventHandler);
+
+	profiler->setThreadName("main");
+
+	while (!glfwWindowShouldClose(window)) {
+		{
+			PROFILE_ZONE("frame");
+
+			eventHandler.routine();
+			renderer.render();
+			interface.drawInfo();
+			glfwPollEvents();
+			glfwSwapBuffers(window);
+		}
+
+		profiler->endFrame();
+	}
+
+	return(0);
+}
+
+